@@ -0,0 +1,111 @@
+#!/bin/bash
+########################################################################
+# Generates a single-header version of the library (regular and
+# differential coding) in the current directory:
+#
+#   streamvbyte_amalgamated.h
+#
+# In exactly one source file, define STREAMVBYTE_IMPLEMENTATION before
+# including it to compile the library there, or define STREAMVBYTE_STATIC
+# in every file including it to get private static inline copies of all
+# functions, which the compiler can inline and specialize (for instance,
+# for a constant number of integers).
+########################################################################
+set -e
+
+SCRIPTPATH="$( cd "$(dirname "$0")" ; pwd -P )"
+OUTPUT=streamvbyte_amalgamated.h
+
+HEADERS="$SCRIPTPATH/include/streamvbyte.h $SCRIPTPATH/include/streamvbytedelta.h"
+SOURCES="$SCRIPTPATH/src/streamvbyte.c $SCRIPTPATH/src/streamvbytedelta.c"
+TABLES="$SCRIPTPATH/src/streamvbyte_shuffle_tables.h"
+PROBES="$SCRIPTPATH/src/streamvbyte_probes.h"
+KERNELS="$SCRIPTPATH/src/streamvbyte_delta_kernels.h"
+INTERNAL="$SCRIPTPATH/src/streamvbyte_internal.h"
+
+for f in $HEADERS $SOURCES $TABLES $PROBES $KERNELS $INTERNAL; do
+  if [ ! -e "$f" ]; then
+    echo "missing $f" >&2
+    exit 1
+  fi
+done
+
+# names of the file-scope static functions and variables of source files
+statics() {
+  sed -n 's/^static [^(=;]*[ *]\([A-Za-z_][A-Za-z0-9_]*\) *[(=[].*/\1/p' "$@" | sort -u
+}
+
+# the static names of streamvbytedelta.c (and of the kernels it includes)
+# that streamvbyte.c also uses get a _delta suffix, since both files end up in
+# a single translation unit
+DUPLICATES=$(comm -12 <(statics "$SCRIPTPATH/src/streamvbyte.c") \
+                      <(statics "$SCRIPTPATH/src/streamvbytedelta.c" "$KERNELS"))
+RENAME=""
+for name in $DUPLICATES; do
+  RENAME="$RENAME -e s/\\b${name}\\b/${name}_delta/g"
+done
+
+# prefix the functions with external linkage (prototypes and definitions
+# starting at the beginning of a line) with STREAMVBYTE_DEF
+LINKAGE='s/^\(\(size_t\|int\|void\|uint32_t\|uint8_t\|const uint8_t\) \**\(streamvbyte_\|svb_\)\)/STREAMVBYTE_DEF \1/'
+
+# copy a source file, dropping the library headers (already included) and
+# inlining the tables, the probes, the kernels and the internal prototypes
+# (guarded, so only included once)
+copy_source() {
+  echo "/* begin file $(basename "$1") */"
+  while IFS= read -r line; do
+    case "$line" in
+    '#include "streamvbyte.h"' | '#include "streamvbytedelta.h"') ;;
+    '#include "streamvbyte_shuffle_tables.h"') cat "$TABLES" ;;
+    '#include "streamvbyte_probes.h"') cat "$PROBES" ;;
+    '#include "streamvbyte_delta_kernels.h"') cat "$KERNELS" ;;
+    '#include "streamvbyte_internal.h"') cat "$INTERNAL" ;;
+    *) printf '%s\n' "$line" ;;
+    esac
+  done < "$1" | sed -e "$LINKAGE" $2
+  echo "/* end file $(basename "$1") */"
+}
+
+{
+  echo "/* auto-generated on $(date) by amalgamation.sh. Do not edit! */"
+  cat <<'EOF'
+// Single-header version of StreamVByte (regular and differential coding).
+// Define STREAMVBYTE_IMPLEMENTATION in exactly one source file before
+// including this header to compile the library in it, or define
+// STREAMVBYTE_STATIC before every inclusion to make all functions static
+// inline, so that they can be inlined and specialized by the compiler.
+// Defining STREAMVBYTE_DEF overrides the linkage of the functions.
+#ifndef STREAMVBYTE_AMALGAMATED_H_
+#define STREAMVBYTE_AMALGAMATED_H_
+
+#ifndef STREAMVBYTE_DEF
+#ifdef STREAMVBYTE_STATIC
+#define STREAMVBYTE_DEF static inline
+#else
+#define STREAMVBYTE_DEF extern
+#endif
+#endif
+
+EOF
+  for h in $HEADERS; do
+    echo "/* begin file $(basename "$h") */"
+    sed -e "$LINKAGE" "$h"
+    echo "/* end file $(basename "$h") */"
+  done
+  cat <<'EOF'
+
+#if defined(STREAMVBYTE_IMPLEMENTATION) || defined(STREAMVBYTE_STATIC)
+
+EOF
+  copy_source "$SCRIPTPATH/src/streamvbyte.c"
+  copy_source "$SCRIPTPATH/src/streamvbytedelta.c" "$RENAME"
+  cat <<'EOF'
+
+#endif /* STREAMVBYTE_IMPLEMENTATION || STREAMVBYTE_STATIC */
+
+#endif /* STREAMVBYTE_AMALGAMATED_H_ */
+EOF
+} > "$OUTPUT"
+
+echo "Created $OUTPUT (renamed in streamvbytedelta.c:" $DUPLICATES")"
@@ -17,18 +17,28 @@ extern "C" {
 // The pointer "in" should point to "length" values of size uint32_t
 // there is no alignment requirement on the out pointer
 // For safety, the out pointer should point to at least streamvbyte_max_compressedbyte(length)
-// bytes.
+// bytes, or to exactly streamvbyte_compressedbytes(in, length) bytes: no byte is
+// written past the returned number of bytes.
 size_t streamvbyte_encode(uint32_t *in, uint32_t length, uint8_t *out);
 
+// return the exact number of bytes that streamvbyte_encode writes for these
+// length input integers
+size_t streamvbyte_compressedbytes(const uint32_t *in, uint32_t length);
+
 // return the maximum number of compressed bytes given length input integers
-static size_t streamvbyte_max_compressedbytes(uint32_t length) {
+static inline size_t streamvbyte_max_compressedbytes64(size_t length) {
    // number of control bytes:
-   size_t cb = (length + 3) / 4;
+   size_t cb = length / 4 + (length % 4 != 0);
    // maximum number of control bytes:
-   size_t db = (size_t) length * sizeof(uint32_t);
+   size_t db = length * sizeof(uint32_t);
    return cb + db;
 }
 
+// return the maximum number of compressed bytes given length input integers
+static inline size_t streamvbyte_max_compressedbytes(uint32_t length) {
+   return streamvbyte_max_compressedbytes64(length);
+}
+
 
 // Read "length" 32-bit integers in varint format from in, storing the result in out.
 // Returns the number of bytes read.
@@ -38,6 +48,13 @@ static size_t streamvbyte_max_compressedbytes(uint32_t length) {
 // The out pointer should point to length * sizeof(uint32_t) bytes.
 size_t streamvbyte_decode(const uint8_t *in, uint32_t *out, uint32_t length);
 
+// Versions of the above taking the number of integers ("length") as a size_t,
+// for streams of more than 4 billion integers on 64-bit systems. The format is
+// unchanged: streamvbyte_encode64 and streamvbyte_encode produce the same bytes.
+size_t streamvbyte_encode64(const uint32_t *in, size_t length, uint8_t *out);
+size_t streamvbyte_compressedbytes64(const uint32_t *in, size_t length);
+size_t streamvbyte_decode64(const uint8_t *in, uint32_t *out, size_t length);
+
 #if defined(__cplusplus)
 };
 #endif
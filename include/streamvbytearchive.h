@@ -0,0 +1,58 @@
+#ifndef INCLUDE_STREAMVBYTEARCHIVE_H_
+#define INCLUDE_STREAMVBYTEARCHIVE_H_
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <inttypes.h>
+#include <stdint.h>// please use a C99-compatible compiler
+#include <stddef.h>
+
+// An archival variant of the StreamVByte format, trading decoding speed for
+// size: the control bytes are Huffman coded while the data bytes are stored
+// unchanged. The control bytes of real data are highly skewed (small values
+// dominate), so they often shrink to a fraction of their size.
+//
+// The stream starts with a mode byte. In mode 0 the regular StreamVByte
+// format follows (used when Huffman coding would not save space). In mode 1
+// the mode byte is followed by
+// - the code lengths of the 256 control byte values, 4 bits each (128 bytes),
+// - the sizes in bytes of the 4 Huffman streams, 32-bit little endian (16 bytes),
+// - the 4 Huffman streams: control byte i is stored in stream i % 4 so that
+//   the decoder can interleave 4 independent bit readers,
+// - the data bytes.
+
+// Encode an array of a given length read from in to out in the archival format.
+// Returns the number of bytes written.
+// The number of values being stored (length) is not encoded in the compressed stream,
+// the caller is responsible for keeping a record of this length.
+// there is no alignment requirement on the out pointer
+// For safety, the out pointer should point to at least streamvbyte_archive_max_compressedbytes(length)
+// bytes.
+size_t streamvbyte_archive_encode(const uint32_t *in, uint32_t length, uint8_t *out);
+
+// return the maximum number of compressed bytes given length input integers
+static inline size_t streamvbyte_archive_max_compressedbytes(uint32_t length) {
+   // number of control bytes:
+   size_t cb = ((size_t) length + 3) / 4;
+   // maximum number of data bytes:
+   size_t db = (size_t) length * sizeof(uint32_t);
+   // the Huffman coded keys are only used when they are smaller than the
+   // regular ones, so only the mode byte is added
+   return 1 + cb + db;
+}
+
+// Read "length" 32-bit integers in the archival format from in, storing the result in out.
+// Returns the number of bytes read.
+// The caller is responsible for knowing how many integers ("length") are to be read:
+// this information ought to be stored somehow.
+// There is no alignment requirement on the "in" pointer.
+// The out pointer should point to length * sizeof(uint32_t) bytes.
+size_t streamvbyte_archive_decode(const uint8_t *in, uint32_t *out, uint32_t length);
+
+#if defined(__cplusplus)
+};
+#endif
+
+#endif /* INCLUDE_STREAMVBYTEARCHIVE_H_ */
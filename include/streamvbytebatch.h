@@ -0,0 +1,46 @@
+#ifndef INCLUDE_STREAMVBYTEBATCH_H_
+#define INCLUDE_STREAMVBYTEBATCH_H_
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <inttypes.h>
+#include <stdint.h>// please use a C99-compatible compiler
+#include <stddef.h>
+
+// Decoding many short streams whose bytes are not in cache mostly waits on
+// memory: each stream stalls on its first control bytes, then on its data.
+// The functions below decode a batch of streams, keeping up to
+// STREAMVBYTE_BATCH_INFLIGHT of them in flight and going round-robin from one
+// to the next (asynchronous memory access chaining): every step of a stream
+// prefetches what its next step reads, so that while the data of one stream
+// comes from memory, the others get decoded. Long streams are processed by
+// chunks of STREAMVBYTE_BATCH_CHUNK integers.
+// Streams that are already in cache decode faster one at a time, with
+// streamvbyte_decode or streamvbyte_delta_decode.
+
+#define STREAMVBYTE_BATCH_INFLIGHT 8
+#define STREAMVBYTE_BATCH_CHUNK 128
+
+typedef struct {
+  const uint8_t *in; // the compressed stream
+  uint32_t *out;     // room for length integers
+  uint32_t length;   // number of integers of the stream
+  uint32_t prev;     // starting value, for differential coding
+} streamvbyte_batch_t;
+
+// Decode the count streams of lists, in the format of streamvbyte_encode,
+// each to its out pointer. The prev fields are ignored.
+// Returns the total number of bytes read.
+size_t streamvbyte_decode_batch(const streamvbyte_batch_t *lists, size_t count);
+
+// Same as streamvbyte_decode_batch for streams in the format of
+// streamvbyte_delta_encode, each starting from its prev field.
+size_t streamvbyte_delta_decode_batch(const streamvbyte_batch_t *lists, size_t count);
+
+#if defined(__cplusplus)
+};
+#endif
+
+#endif /* INCLUDE_STREAMVBYTEBATCH_H_ */
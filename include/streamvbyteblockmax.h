@@ -0,0 +1,86 @@
+#ifndef INCLUDE_STREAMVBYTEBLOCKMAX_H_
+#define INCLUDE_STREAMVBYTEBLOCKMAX_H_
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <inttypes.h>
+#include <stdint.h>// please use a C99-compatible compiler
+#include <stddef.h>
+
+// Posting lists with block-max metadata, for dynamic pruning (WAND, MaxScore)
+// over compressed lists. The sorted document identifiers and a value column
+// (a term frequency, an impact...) are cut in blocks of blocksize entries.
+// Every block is stored as its document identifiers in the differential
+// StreamVByte format followed by its values in the regular format, and is
+// described by an entry of a side array holding the bounds used to skip it:
+// a block whose largest value cannot enter the top-k, or whose last
+// document identifier is smaller than the one sought, need not be decoded.
+//
+// Offsets are 32-bit to keep the side array compact: the compressed stream
+// must be smaller than 4 GB.
+
+typedef struct {
+  uint32_t lastdocid;   // last (largest) document identifier of the block
+  uint32_t maxvalue;    // largest value of the block
+  uint32_t offset;      // start of the block in the compressed stream
+  uint32_t valueoffset; // start of the values of the block
+} streamvbyte_block_t;
+
+// return the number of blocks of blocksize entries covering length entries
+// (0 if blocksize is 0)
+static inline size_t streamvbyte_blockmax_blocks(uint32_t length, uint32_t blocksize) {
+   if (blocksize == 0)
+     return 0;
+   return ((size_t) length + blocksize - 1) / blocksize;
+}
+
+// return the maximum number of compressed bytes given length entries
+static inline size_t streamvbyte_blockmax_max_compressedbytes(uint32_t length, uint32_t blocksize) {
+   // number of control bytes, rounded up in each block:
+   size_t cb = (size_t) length / 4 + streamvbyte_blockmax_blocks(length, blocksize);
+   // maximum number of data bytes:
+   size_t db = (size_t) length * sizeof(uint32_t);
+   // document identifiers and values
+   return 2 * (cb + db);
+}
+
+// Encode length entries (docids[i], values[i]) to out, docids being sorted in
+// non-decreasing order, and describe each of the blocks of blocksize entries
+// (the last one may be shorter) in blocks, which should have room for
+// streamvbyte_blockmax_blocks(length, blocksize) entries.
+// Returns the number of bytes written, or 0 if blocksize is 0 (which is
+// rejected: nothing is written).
+// The number of entries (length) and the block size are not encoded in the
+// compressed stream, the caller is responsible for keeping a record of them.
+// there is no alignment requirement on the out pointer
+// For safety, the out pointer should point to at least
+// streamvbyte_blockmax_max_compressedbytes(length, blocksize) bytes.
+size_t streamvbyte_blockmax_encode(const uint32_t *docids, const uint32_t *values,
+                                   uint32_t length, uint32_t blocksize,
+                                   uint8_t *out, streamvbyte_block_t *blocks);
+
+// Return the index of the first block, starting from block "block", which may
+// hold an entry with a document identifier at least "target" and a value
+// larger than "threshold", or the number of blocks (nblocks) if there is none.
+// Only the side array is read.
+size_t streamvbyte_blockmax_seek(const streamvbyte_block_t *blocks, size_t nblocks,
+                                 size_t block, uint32_t target, uint32_t threshold);
+
+// Decode the entries of block "block" of the stream in, writing the
+// document identifiers to docids and the values to values (which may be NULL
+// when only the document identifiers are needed).
+// Returns the number of entries of the block (at most blocksize), or 0 if
+// blocksize is 0.
+size_t streamvbyte_blockmax_decode_block(const uint8_t *in,
+                                         const streamvbyte_block_t *blocks,
+                                         size_t block, uint32_t length,
+                                         uint32_t blocksize, uint32_t *docids,
+                                         uint32_t *values);
+
+#if defined(__cplusplus)
+};
+#endif
+
+#endif /* INCLUDE_STREAMVBYTEBLOCKMAX_H_ */
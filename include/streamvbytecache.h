@@ -0,0 +1,88 @@
+#ifndef INCLUDE_STREAMVBYTECACHE_H_
+#define INCLUDE_STREAMVBYTECACHE_H_
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <inttypes.h>
+#include <stdint.h>// please use a C99-compatible compiler
+#include <stddef.h>
+
+#include "streamvbyteblockmax.h"
+
+// A cache of decoded blocks shared by several threads, keyed by a stream
+// identifier chosen by the caller and a block index. It lives in a memory
+// region given by the caller (its memory budget) and never allocates.
+//
+// Lookups take no lock and copy nothing: they return a pointer to the cached
+// values. Threads register once, then bracket their lookups between
+// streamvbyte_cache_enter and streamvbyte_cache_leave: the pointers stay
+// valid until streamvbyte_cache_leave. Blocks are evicted with the CLOCK
+// policy within sets of STREAMVBYTE_CACHE_WAYS blocks, and an evicted block
+// is only overwritten once every thread that might still read it has left
+// (epoch-based reclamation). Insertion never waits: when nothing can be
+// evicted yet, the block is simply not cached.
+//
+// The cache relies on the GCC atomic builtins (GCC, clang).
+
+#define STREAMVBYTE_CACHE_WAYS 8
+
+typedef struct streamvbyte_cache_s streamvbyte_cache_t;
+
+// Set up a cache in the bytes pointed to by mem, for blocks of up to
+// blockvalues integers and up to maxthreads registered threads.
+// Returns NULL if the region cannot hold STREAMVBYTE_CACHE_WAYS blocks.
+// The region must outlive the cache; there is nothing to free.
+streamvbyte_cache_t *streamvbyte_cache_init(void *mem, size_t bytes,
+                                            uint32_t blockvalues,
+                                            uint32_t maxthreads);
+
+// return the number of blocks the cache can hold
+size_t streamvbyte_cache_capacity(const streamvbyte_cache_t *cache);
+
+// Register the calling thread, returning its thread number (to give to the
+// functions below), or -1 if maxthreads threads are already registered.
+int streamvbyte_cache_register(streamvbyte_cache_t *cache);
+
+// Start and end a read-side critical section of thread tid: the pointers
+// returned in between remain valid until streamvbyte_cache_leave.
+// Critical sections do not nest. Long ones delay the reuse of evicted blocks.
+void streamvbyte_cache_enter(streamvbyte_cache_t *cache, int tid);
+void streamvbyte_cache_leave(streamvbyte_cache_t *cache, int tid);
+
+// Return the values of block "block" of stream "stream", or NULL if they are
+// not cached. *count receives their number.
+// Must be called within a critical section.
+const uint32_t *streamvbyte_cache_lookup(streamvbyte_cache_t *cache, int tid,
+                                         uint32_t stream, uint32_t block,
+                                         uint32_t *count);
+
+// Copy count values of block "block" of stream "stream" to the cache,
+// returning a pointer to the cached copy, or NULL if count is larger than
+// blockvalues or no block could be evicted yet. Two threads inserting the same block at
+// the same time may both succeed: the extra copy is evicted in time.
+// Must be called within a critical section.
+const uint32_t *streamvbyte_cache_insert(streamvbyte_cache_t *cache, int tid,
+                                         uint32_t stream, uint32_t block,
+                                         const uint32_t *values, uint32_t count);
+
+// Return block "block" of a stream in the format of streamvbyteblockmax.h:
+// its document identifiers followed by its values (the number of entries of
+// the block, n, is the smaller of blocksize and length - block * blocksize).
+// The block is read from the cache, or decoded and inserted. The cache
+// must have been set up with blockvalues >= 2 * blocksize, and scratch
+// should point to 2 * blocksize integers, used when the block cannot be
+// cached (the result then points to scratch).
+// Must be called within a critical section.
+const uint32_t *streamvbyte_cache_blockmax(streamvbyte_cache_t *cache, int tid,
+                                           uint32_t stream, const uint8_t *in,
+                                           const streamvbyte_block_t *blocks,
+                                           size_t block, uint32_t length,
+                                           uint32_t blocksize, uint32_t *scratch);
+
+#if defined(__cplusplus)
+};
+#endif
+
+#endif /* INCLUDE_STREAMVBYTECACHE_H_ */
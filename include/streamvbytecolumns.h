@@ -0,0 +1,59 @@
+#ifndef INCLUDE_STREAMVBYTECOLUMNS_H_
+#define INCLUDE_STREAMVBYTECOLUMNS_H_
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <inttypes.h>
+#include <stdint.h>// please use a C99-compatible compiler
+#include <stddef.h>
+
+// return the number of key bytes at the start of each stream of length values,
+// the data bytes following them
+static inline size_t streamvbyte_columns_keybytes(uint32_t length) {
+   return length / 4 + (length % 4 != 0); // 2-bits per key (rounded up)
+}
+
+// Encode "ncolumns" columns of "length" values each in a single pass over the rows.
+// Column i is read from in[i] and written to out[i] as an independent StreamVByte
+// stream (the same format as streamvbyte_encode), its size in bytes is stored in sizes[i].
+// Returns the total number of bytes written.
+// The number of values being stored (length) is not encoded in the compressed streams,
+// the caller is responsible for keeping a record of this length.
+// there is no alignment requirement on the out pointers
+// For safety, each out[i] should point to at least streamvbyte_max_compressedbyte(length)
+// bytes ( see streamvbyte.h )
+size_t streamvbyte_encode_columns(const uint32_t *const *in, size_t ncolumns,
+                                  uint32_t length, uint8_t *const *out,
+                                  size_t *sizes);
+
+// Read "ncolumns" StreamVByte streams of "length" values each in lockstep, storing
+// the values of stream in[i] in out[i]. The number of bytes read from in[i] is stored
+// in sizes[i]. Returns the total number of bytes read.
+// Each out[i] should point to length * sizeof(uint32_t) bytes.
+size_t streamvbyte_decode_columns(const uint8_t *const *in, uint32_t *const *out,
+                                  size_t ncolumns, uint32_t length,
+                                  size_t *sizes);
+
+// Same as streamvbyte_encode_columns, but the values are read from "length" rows
+// (array of structures): row r starts at rows + r * stride and the value of column i
+// is the uint32_t found offsets[i] bytes into the row. There is no alignment
+// requirement on the rows.
+size_t streamvbyte_encode_rows(const uint8_t *rows, size_t stride,
+                               const size_t *offsets, size_t ncolumns,
+                               uint32_t length, uint8_t *const *out,
+                               size_t *sizes);
+
+// Same as streamvbyte_decode_columns, but the values are written back into "length"
+// rows laid out as described for streamvbyte_encode_rows. Bytes of the rows that are
+// not covered by a column are left untouched.
+size_t streamvbyte_decode_rows(const uint8_t *const *in, uint8_t *rows,
+                               size_t stride, const size_t *offsets,
+                               size_t ncolumns, uint32_t length, size_t *sizes);
+
+#if defined(__cplusplus)
+};
+#endif
+
+#endif /* INCLUDE_STREAMVBYTECOLUMNS_H_ */
@@ -18,9 +18,14 @@ extern "C" {
 // there is no alignment requirement on the out pointer
 // this version uses differential coding (coding differences between values) starting at prev (you can often set prev to zero)
 // For safety, the out pointer should point to at least streamvbyte_max_compressedbyte(length)
-// bytes ( see streamvbyte.h )
+// bytes ( see streamvbyte.h ), or to exactly streamvbyte_delta_compressedbytes(in, length, prev)
+// bytes: no byte is written past the returned number of bytes.
 size_t streamvbyte_delta_encode(uint32_t *in, uint32_t length, uint8_t *out, uint32_t prev);
 
+// return the exact number of bytes that streamvbyte_delta_encode writes for these
+// length input integers and this value of prev
+size_t streamvbyte_delta_compressedbytes(const uint32_t *in, uint32_t length, uint32_t prev);
+
 // Read "length" 32-bit integers in StreamVByte format from in, storing the result in out.
 // Returns the number of bytes read.
 // The caller is responsible for knowing how many integers ("length") are to be read: 
@@ -30,6 +35,25 @@ size_t streamvbyte_delta_encode(uint32_t *in, uint32_t length, uint8_t *out, uin
 // this version uses differential coding (coding differences between values) starting at prev (you can often set prev to zero)
 size_t streamvbyte_delta_decode(const uint8_t *in, uint32_t *out, uint32_t length, uint32_t prev);
 
+// Versions of the above taking the number of integers ("length") as a size_t,
+// for streams of more than 4 billion integers on 64-bit systems ( see
+// streamvbyte_max_compressedbytes64 in streamvbyte.h ).
+size_t streamvbyte_delta_encode64(const uint32_t *in, size_t length, uint8_t *out, uint32_t prev);
+size_t streamvbyte_delta_compressedbytes64(const uint32_t *in, size_t length, uint32_t prev);
+size_t streamvbyte_delta_decode64(const uint8_t *in, uint32_t *out, size_t length, uint32_t prev);
+
+// Same as streamvbyte_delta_decode, but only the live values are written to
+// out: value v is live when bit v % 64 of live[v / 64] is set (for example, a
+// document identifier that was not deleted). The bitmap must cover every
+// decoded value.
+// Returns how many bytes were read from in, as streamvbyte_delta_decode does,
+// and stores the number of values written to out (at most length) to *written.
+// The out pointer should still point to length * sizeof(uint32_t) bytes.
+size_t streamvbyte_delta_decode_live(const uint8_t *in, uint32_t *out, uint32_t length,
+                                     uint32_t prev, const uint64_t *live, size_t *written);
+size_t streamvbyte_delta_decode_live64(const uint8_t *in, uint32_t *out, size_t length,
+                                       uint32_t prev, const uint64_t *live, size_t *written);
+
 #if defined(__cplusplus)
 };
 #endif
@@ -0,0 +1,68 @@
+#ifndef INCLUDE_STREAMVBYTEINTERLEAVED_H_
+#define INCLUDE_STREAMVBYTEINTERLEAVED_H_
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <inttypes.h>
+#include <stdint.h>// please use a C99-compatible compiler
+#include <stddef.h>
+
+// A variant of the StreamVByte format where the integers are split into 1 to
+// STREAMVBYTE_INTERLEAVED_MAX_STREAMS independent sub-streams. The quads
+// (groups of 4 consecutive integers, the last one possibly shorter) are dealt
+// round-robin: quad q goes to sub-stream q % streams.
+// When decoding a regular stream, finding the data of a quad requires the
+// length of the previous one (a load, then an add, then the next load), so
+// the quads are decoded one after the other however many shuffles the
+// processor could run. The sub-streams have their own data pointers, which
+// the decoder advances side by side: their chains overlap.
+//
+// The compressed stream holds:
+// - a byte: the number of sub-streams,
+// - for each sub-stream, its size in bytes (32-bit little endian),
+// - the sub-streams, one after the other, each in the regular format (its
+//   control bytes followed by its data bytes).
+// The compressed data is 1 + 4 * streams bytes larger than with
+// streamvbyte_encode. On a recent x64 processor, long streams (thousands of
+// integers) of various byte lengths decode about 10% faster with 2
+// sub-streams than with streamvbyte_decode, and 4 sub-streams do not help
+// further. Short streams (a few hundred integers or less) decode faster in
+// the regular format, as do streams of integers of the same byte length.
+
+#define STREAMVBYTE_INTERLEAVED_MAX_STREAMS 4
+
+// Encode an array of a given length read from in to out with the given number
+// of sub-streams (1 to STREAMVBYTE_INTERLEAVED_MAX_STREAMS, see above). Returns the number of bytes written, 0 if the number of
+// sub-streams is not supported.
+// The number of values being stored (length) is not encoded in the compressed stream,
+// the caller is responsible for keeping a record of this length.
+// there is no alignment requirement on the out pointer
+// For safety, the out pointer should point to at least
+// streamvbyte_interleaved_max_compressedbytes(length) bytes.
+size_t streamvbyte_interleaved_encode(const uint32_t *in, uint32_t length,
+                                      uint8_t *out, int streams);
+
+// return the maximum number of compressed bytes given length input integers
+static inline size_t streamvbyte_interleaved_max_compressedbytes(uint32_t length) {
+   // number of control bytes (one per quad, whatever the sub-stream):
+   size_t cb = ((size_t) length + 3) / 4;
+   // maximum number of data bytes:
+   size_t db = (size_t) length * sizeof(uint32_t);
+   return 1 + 4 * STREAMVBYTE_INTERLEAVED_MAX_STREAMS + cb + db;
+}
+
+// Read "length" 32-bit integers in the interleaved format from in, storing the result in out.
+// Returns the number of bytes read.
+// The caller is responsible for knowing how many integers ("length") are to be read:
+// this information ought to be stored somehow.
+// There is no alignment requirement on the "in" pointer.
+// The out pointer should point to length * sizeof(uint32_t) bytes.
+size_t streamvbyte_interleaved_decode(const uint8_t *in, uint32_t *out, uint32_t length);
+
+#if defined(__cplusplus)
+};
+#endif
+
+#endif /* INCLUDE_STREAMVBYTEINTERLEAVED_H_ */
@@ -0,0 +1,60 @@
+#ifndef INCLUDE_STREAMVBYTEPOSTINGS_H_
+#define INCLUDE_STREAMVBYTEPOSTINGS_H_
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <inttypes.h>
+#include <stdint.h>// please use a C99-compatible compiler
+#include <stddef.h>
+
+// Posting lists of (document identifier, term frequency) pairs, stored side
+// by side in blocks of STREAMVBYTE_POSTINGS_BLOCK entries so that a single
+// pass decodes both: the document identifiers use differential coding, the
+// frequencies the regular StreamVByte coding.
+//
+// Each block (the last one may be shorter) is made of
+// - the number of data bytes of the document identifiers (16-bit little endian),
+// - the control bytes of the document identifiers, then of the frequencies,
+// - the data bytes of the document identifiers, then of the frequencies.
+
+#define STREAMVBYTE_POSTINGS_BLOCK 128
+
+// Encode length pairs (docids[i], freqs[i]) to out. The document identifiers
+// are coded as differences, starting at prev (you can often set prev to zero).
+// Returns the number of bytes written.
+// The number of pairs (length) is not encoded in the compressed stream,
+// the caller is responsible for keeping a record of this length.
+// there is no alignment requirement on the out pointer
+// For safety, the out pointer should point to at least
+// streamvbyte_postings_max_compressedbytes(length) bytes.
+size_t streamvbyte_postings_encode(const uint32_t *docids, const uint32_t *freqs,
+                                   uint32_t length, uint8_t *out, uint32_t prev);
+
+// return the maximum number of compressed bytes given length pairs
+static inline size_t streamvbyte_postings_max_compressedbytes(uint32_t length) {
+   size_t blocks = ((size_t) length + STREAMVBYTE_POSTINGS_BLOCK - 1) / STREAMVBYTE_POSTINGS_BLOCK;
+   // number of control bytes (all blocks but the last hold a multiple of 4 pairs):
+   size_t cb = ((size_t) length + 3) / 4;
+   // maximum number of data bytes:
+   size_t db = (size_t) length * sizeof(uint32_t);
+   return 2 * blocks + 2 * (cb + db);
+}
+
+// Read length pairs from in, storing the document identifiers in docids and
+// the frequencies in freqs. prev must be the value given to the encoder.
+// Returns the number of bytes read.
+// The caller is responsible for knowing how many pairs ("length") are to be read:
+// this information ought to be stored somehow.
+// There is no alignment requirement on the "in" pointer, and no byte is read past
+// the returned number of bytes.
+// The docids and freqs pointers should each point to length * sizeof(uint32_t) bytes.
+size_t streamvbyte_postings_decode(const uint8_t *in, uint32_t *docids, uint32_t *freqs,
+                                   uint32_t length, uint32_t prev);
+
+#if defined(__cplusplus)
+};
+#endif
+
+#endif /* INCLUDE_STREAMVBYTEPOSTINGS_H_ */
@@ -0,0 +1,52 @@
+#ifndef INCLUDE_STREAMVBYTERLE_H_
+#define INCLUDE_STREAMVBYTERLE_H_
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <inttypes.h>
+#include <stdint.h>// please use a C99-compatible compiler
+#include <stddef.h>
+
+// A variant of the StreamVByte format where the control bytes are run-length
+// coded. The control bytes are replaced by a sequence of entries:
+// - a byte h < 128 followed by h + 1 control bytes (literal entry),
+// - a byte h >= 128 followed by one control byte, repeated h - 125 times (run entry).
+// The entries cover the (length + 3) / 4 control bytes and are immediately
+// followed by the data bytes, which are unchanged. Runs of identical control
+// bytes are common with small values (e.g., long runs of 0x00 when all values
+// fit in a byte) and also decode faster since each run uses a single table lookup.
+
+// Encode an array of a given length read from in to out in the run-length coded format.
+// Returns the number of bytes written.
+// The number of values being stored (length) is not encoded in the compressed stream,
+// the caller is responsible for keeping a record of this length.
+// there is no alignment requirement on the out pointer
+// For safety, the out pointer should point to at least streamvbyte_rle_max_compressedbytes(length)
+// bytes. Unlike streamvbyte_encode, the whole buffer may be used as scratch space.
+size_t streamvbyte_rle_encode(const uint32_t *in, uint32_t length, uint8_t *out);
+
+// return the maximum number of compressed bytes given length input integers
+static inline size_t streamvbyte_rle_max_compressedbytes(uint32_t length) {
+   // number of control bytes:
+   size_t cb = ((size_t) length + 3) / 4;
+   // maximum number of data bytes:
+   size_t db = (size_t) length * sizeof(uint32_t);
+   // at most one entry header per 128 control bytes, plus slack for the encoder
+   return cb + db + cb / 128 + 2;
+}
+
+// Read "length" 32-bit integers in the run-length coded format from in, storing the result in out.
+// Returns the number of bytes read.
+// The caller is responsible for knowing how many integers ("length") are to be read:
+// this information ought to be stored somehow.
+// There is no alignment requirement on the "in" pointer.
+// The out pointer should point to length * sizeof(uint32_t) bytes.
+size_t streamvbyte_rle_decode(const uint8_t *in, uint32_t *out, uint32_t length);
+
+#if defined(__cplusplus)
+};
+#endif
+
+#endif /* INCLUDE_STREAMVBYTERLE_H_ */
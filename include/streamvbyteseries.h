@@ -0,0 +1,86 @@
+#ifndef INCLUDE_STREAMVBYTESERIES_H_
+#define INCLUDE_STREAMVBYTESERIES_H_
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <inttypes.h>
+#include <stdint.h>// please use a C99-compatible compiler
+#include <stddef.h>
+
+// A store for the samples (timestamp, value) of a time series, appended in
+// time order. It lives in a memory region given by the caller and never
+// allocates.
+//
+// Time is cut in windows of a fixed duration (a multiple of it starts each
+// window) and the samples of a window go to a chunk, cut early when it holds
+// maxsamples samples. The chunk receiving samples (the head chunk) is kept
+// uncompressed. Once it is complete, it is compressed into two streams in
+// the regular StreamVByte format:
+// - its timestamps, as zigzag deltas of deltas from the first one (regular
+//   intervals code in 1 byte per sample, however long),
+// - its values, as zigzag deltas from the previous value (0 for the first).
+// The compressed chunks are stored one after the other in a ring of bytes,
+// and an index keeps the first and last timestamps of each of them. Queries
+// find the first chunk overlapping the time range by binary search over the
+// index and only decode the chunks overlapping the range. Retention drops the
+// oldest chunks: this is O(1) per chunk, nothing is moved.
+//
+// A store is not thread-safe: use a lock, or one store per thread.
+
+typedef struct streamvbyte_series_s streamvbyte_series_t;
+
+// Set up a store in the bytes pointed to by mem, for windows of duration
+// units of time (1 to 2^31) and chunks of up to maxsamples samples (at least
+// 1), with an index of up to maxchunks chunks. The rest of the region holds
+// the compressed chunks.
+// Returns NULL if the parameters are invalid or the region cannot hold a
+// chunk of maxsamples samples.
+// The region must outlive the store; there is nothing to free.
+streamvbyte_series_t *streamvbyte_series_init(void *mem, size_t bytes,
+                                              uint64_t duration,
+                                              uint32_t maxsamples,
+                                              uint32_t maxchunks);
+
+// Append a sample. Timestamps must not decrease.
+// Returns 0 on success, -1 if the timestamp is smaller than the previous one,
+// or -1 if the head chunk has to be compressed and the index or the ring is
+// full, in which case nothing is modified: drop old chunks with
+// streamvbyte_series_drop_before and try again.
+int streamvbyte_series_append(streamvbyte_series_t *series, uint64_t timestamp,
+                              uint32_t value);
+
+// Compress the head chunk now (a later sample in the same window then starts
+// a new chunk). Returns 0 on success, -1 if the index or the ring is full.
+int streamvbyte_series_flush(streamvbyte_series_t *series);
+
+// Drop the chunks all of whose samples are older than timestamp (the head
+// chunk included). Returns the number of samples dropped.
+size_t streamvbyte_series_drop_before(streamvbyte_series_t *series,
+                                      uint64_t timestamp);
+
+// Return the number of samples in the store.
+size_t streamvbyte_series_count(const streamvbyte_series_t *series);
+
+// Return the number of bytes used by the compressed chunks.
+size_t streamvbyte_series_compressedbytes(const streamvbyte_series_t *series);
+
+// Return the number of samples of the chunks overlapping the time range
+// [from, to): the room the outputs of streamvbyte_series_query need.
+size_t streamvbyte_series_query_bound(const streamvbyte_series_t *series,
+                                      uint64_t from, uint64_t to);
+
+// Write the samples whose timestamp is in [from, to) to timestamps and
+// values, in time order. Returns the number of samples written.
+// Both outputs should have room for streamvbyte_series_query_bound(series,
+// from, to) entries (the room past the result is used as scratch space).
+size_t streamvbyte_series_query(const streamvbyte_series_t *series,
+                                uint64_t from, uint64_t to,
+                                uint64_t *timestamps, uint32_t *values);
+
+#if defined(__cplusplus)
+};
+#endif
+
+#endif /* INCLUDE_STREAMVBYTESERIES_H_ */
@@ -0,0 +1,75 @@
+#ifndef INCLUDE_STREAMVBYTESET_H_
+#define INCLUDE_STREAMVBYTESET_H_
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <inttypes.h>
+#include <stdint.h>// please use a C99-compatible compiler
+#include <stddef.h>
+
+// Compressed sets of 32-bit integers in the manner of Roaring bitmaps: the
+// values are partitioned by their 16 most significant bits into chunks of
+// 2^16 values, and every non-empty chunk is stored in a container of its own,
+// whichever is smaller:
+// - an array: the values of the chunk in the differential StreamVByte format,
+//   starting from the first value of the chunk (chunk << 16), so that only
+//   the low 16 bits of the first value and the gaps are coded (1 or 2 bytes
+//   each),
+// - a bitmap: 2^16 bits (STREAMVBYTE_SET_BITMAP_BYTES bytes), bit i set if
+//   the chunk holds its i-th value. Dense chunks (from about 6500 values, a
+//   gap of 10 or less on average) use bitmaps.
+// The compressed set holds the number of containers (32-bit), a directory of
+// 12 bytes per container (chunk and type on 16 bits each, cardinality and
+// offset of the container in the set on 32 bits each, little endian) sorted
+// by chunk, then the containers. The set must be smaller than 4 GB.
+// Intersections and unions go chunk by chunk and use the representation of
+// both containers: bitmaps are combined 64 bits at a time, arrays are merged
+// or probed against bitmaps, a block of values at a time.
+
+#define STREAMVBYTE_SET_BITMAP_BYTES 8192
+
+// Encode the length strictly increasing values of in to out.
+// Returns the number of bytes written.
+// there is no alignment requirement on the out pointer
+// For safety, the out pointer should point to at least
+// streamvbyte_set_max_compressedbytes(length) bytes.
+size_t streamvbyte_set_encode(const uint32_t *in, uint32_t length, uint8_t *out);
+
+// return the maximum number of compressed bytes given length input integers
+static inline size_t streamvbyte_set_max_compressedbytes(uint32_t length) {
+   // a container of n values takes at most 12 bytes in the directory, (n + 3) / 4
+   // control bytes and 2 * n data bytes: at most 16 bytes per value
+   return 4 + 16 * (size_t) length;
+}
+
+// Return the number of values of the set in.
+size_t streamvbyte_set_cardinality(const uint8_t *in);
+
+// Write the values of the set in to out, in increasing order.
+// The out pointer should point to streamvbyte_set_cardinality(in) * sizeof(uint32_t) bytes.
+// Returns the number of values written.
+size_t streamvbyte_set_decode(const uint8_t *in, uint32_t *out);
+
+// Returns 1 if the set in holds value, 0 otherwise. Only the container of the
+// chunk of value is read, up to value if it is an array.
+int streamvbyte_set_contains(const uint8_t *in, uint32_t value);
+
+// Write the values found in both sets a and b to out, in increasing order.
+// Returns the number of values written. The out pointer should have room for
+// the larger of the cardinalities of a and b (the room past the result is
+// used as scratch space).
+size_t streamvbyte_set_intersect(const uint8_t *a, const uint8_t *b, uint32_t *out);
+
+// Write the values found in either set a or b to out, in increasing order.
+// Returns the number of values written. The out pointer should have room for
+// the sum of the cardinalities of a and b (the room past the result is used as
+// scratch space).
+size_t streamvbyte_set_union(const uint8_t *a, const uint8_t *b, uint32_t *out);
+
+#if defined(__cplusplus)
+};
+#endif
+
+#endif /* INCLUDE_STREAMVBYTESET_H_ */
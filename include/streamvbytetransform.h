@@ -0,0 +1,66 @@
+#ifndef INCLUDE_STREAMVBYTETRANSFORM_H_
+#define INCLUDE_STREAMVBYTETRANSFORM_H_
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <inttypes.h>
+#include <stdint.h>// please use a C99-compatible compiler
+#include <stddef.h>
+
+// A variant of the StreamVByte format where every block of
+// STREAMVBYTE_TRANSFORM_BLOCK integers is transformed before being encoded,
+// the transform being chosen per block as the one giving the smallest
+// encoding. Sorted blocks favor differential coding, near-sorted blocks
+// zigzag differential coding, blocks of values sharing their high bits the
+// XOR with the previous value, and random blocks no transform at all.
+//
+// Each block is stored as a tag byte (one of the STREAMVBYTE_TRANSFORM_*
+// values) followed by the block in the regular StreamVByte format (control
+// bytes, then data bytes). The transforms chain across blocks: the first
+// value of a block is transformed against the last value of the previous
+// block (0 for the first block).
+
+#define STREAMVBYTE_TRANSFORM_BLOCK 128
+
+#define STREAMVBYTE_TRANSFORM_NONE 0
+#define STREAMVBYTE_TRANSFORM_DELTA 1        // in[i] - in[i-1]
+#define STREAMVBYTE_TRANSFORM_ZIGZAG_DELTA 2 // zigzag(in[i] - in[i-1])
+#define STREAMVBYTE_TRANSFORM_XOR 3          // in[i] ^ in[i-1]
+
+// Encode an array of a given length read from in to out, choosing a transform
+// for each block.
+// Returns the number of bytes written.
+// The number of values being stored (length) is not encoded in the compressed stream,
+// the caller is responsible for keeping a record of this length.
+// there is no alignment requirement on the out pointer
+// For safety, the out pointer should point to at least streamvbyte_transform_max_compressedbytes(length)
+// bytes: no byte is written past the returned number of bytes.
+size_t streamvbyte_transform_encode(const uint32_t *in, uint32_t length, uint8_t *out);
+
+// return the maximum number of compressed bytes given length input integers
+static inline size_t streamvbyte_transform_max_compressedbytes(uint32_t length) {
+   // number of control bytes (all blocks but the last hold a multiple of 4 integers):
+   size_t cb = ((size_t) length + 3) / 4;
+   // maximum number of data bytes:
+   size_t db = (size_t) length * sizeof(uint32_t);
+   // one tag per block
+   size_t tags = ((size_t) length + STREAMVBYTE_TRANSFORM_BLOCK - 1) / STREAMVBYTE_TRANSFORM_BLOCK;
+   return cb + db + tags;
+}
+
+// Read "length" 32-bit integers from in, storing the result in out.
+// Returns the number of bytes read.
+// The caller is responsible for knowing how many integers ("length") are to be read:
+// this information ought to be stored somehow.
+// There is no alignment requirement on the "in" pointer, and no byte is read past
+// the returned number of bytes.
+// The out pointer should point to length * sizeof(uint32_t) bytes.
+size_t streamvbyte_transform_decode(const uint8_t *in, uint32_t *out, uint32_t length);
+
+#if defined(__cplusplus)
+};
+#endif
+
+#endif /* INCLUDE_STREAMVBYTETRANSFORM_H_ */
@@ -0,0 +1,96 @@
+#ifndef INCLUDE_STREAMVBYTEUPDATABLE_H_
+#define INCLUDE_STREAMVBYTEUPDATABLE_H_
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+#include <inttypes.h>
+#include <stdint.h>// please use a C99-compatible compiler
+#include <stddef.h>
+
+// A block-structured variant of the StreamVByte format supporting point
+// updates. The values are cut in blocks of STREAMVBYTE_UPDATABLE_BLOCK
+// integers, each stored in the regular format (control bytes, then data
+// bytes) in a slot with some slack. A slot array, kept by the caller, locates
+// the blocks:
+// - an update keeping the byte length of the value patches its data bytes,
+// - an update changing it rewrites the rest of the block within its slot,
+// - if the slot is too small, the block moves to a new slot, large enough for
+//   any content, at the end of the used part of the buffer.
+// Updates thus cost O(STREAMVBYTE_UPDATABLE_BLOCK), never O(length). The slots
+// abandoned by moved blocks are reclaimed by streamvbyte_updatable_compact.
+//
+// Offsets are 32-bit to keep the slot array compact: the buffer must be
+// smaller than 4 GB.
+
+#define STREAMVBYTE_UPDATABLE_BLOCK 64
+
+typedef struct {
+  uint32_t offset;   // start of the block in the buffer
+  uint16_t size;     // bytes used by the block
+  uint16_t capacity; // bytes reserved for the block, at least size
+} streamvbyte_slot_t;
+
+// return the number of slots (blocks) covering length integers
+static inline size_t streamvbyte_updatable_slots(uint32_t length) {
+   return ((size_t) length + STREAMVBYTE_UPDATABLE_BLOCK - 1) / STREAMVBYTE_UPDATABLE_BLOCK;
+}
+
+// return the maximum number of bytes used by streamvbyte_updatable_encode
+// given length input integers and slack bytes per block
+static inline size_t streamvbyte_updatable_max_compressedbytes(uint32_t length, uint32_t slack) {
+   // number of control bytes:
+   size_t cb = ((size_t) length + 3) / 4;
+   // maximum number of data bytes:
+   size_t db = (size_t) length * sizeof(uint32_t);
+   // the slack never makes a slot larger than the largest block
+   (void) slack;
+   return cb + db;
+}
+
+// Encode an array of a given length read from in to out, leaving up to slack
+// free bytes after each block, and fill the slots array which should have
+// room for streamvbyte_updatable_slots(length) entries.
+// Returns the number of bytes used (the end of the last slot).
+// The buffer may be larger than this: streamvbyte_updatable_set uses the
+// remaining bytes to move blocks that outgrow their slot.
+// The number of values being stored (length) is not encoded in the compressed stream,
+// the caller is responsible for keeping a record of this length.
+// there is no alignment requirement on the out pointer
+size_t streamvbyte_updatable_encode(const uint32_t *in, uint32_t length, uint32_t slack,
+                                    uint8_t *out, streamvbyte_slot_t *slots);
+
+// Return the value at position index.
+uint32_t streamvbyte_updatable_get(const uint8_t *in, const streamvbyte_slot_t *slots,
+                                   uint32_t length, uint32_t index);
+
+// Replace the value at position index by value. "used" is the number of used
+// bytes of the buffer (as returned by streamvbyte_updatable_encode) and is
+// updated when a block moves; "capacity" is the size of the buffer.
+// Returns 0 on success, or -1 when a block has to move and the buffer is full,
+// in which case nothing is modified: compact the buffer (or copy it to a
+// larger one) and try again.
+int streamvbyte_updatable_set(uint8_t *buf, size_t *used, size_t capacity,
+                              streamvbyte_slot_t *slots, uint32_t length,
+                              uint32_t index, uint32_t value);
+
+// Copy the blocks of in to out in order, leaving up to slack free bytes after
+// each, and update the slots. out should point to at least
+// streamvbyte_updatable_max_compressedbytes(length, slack) bytes and must not
+// overlap in.
+// Returns the number of bytes used.
+size_t streamvbyte_updatable_compact(const uint8_t *in, streamvbyte_slot_t *slots,
+                                     uint32_t length, uint32_t slack, uint8_t *out);
+
+// Read "length" 32-bit integers from in, storing the result in out.
+// Returns the number of bytes of the blocks that were read.
+// The out pointer should point to length * sizeof(uint32_t) bytes.
+size_t streamvbyte_updatable_decode(const uint8_t *in, const streamvbyte_slot_t *slots,
+                                    uint32_t *out, uint32_t length);
+
+#if defined(__cplusplus)
+};
+#endif
+
+#endif /* INCLUDE_STREAMVBYTEUPDATABLE_H_ */
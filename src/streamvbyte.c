@@ -22,11 +22,23 @@
 #endif
 #ifdef __AVX__
 
+#define SVB_ENCODING_SHUFFLE_TABLE
 #include "streamvbyte_shuffle_tables.h"
 
 #endif
+#include "streamvbyte_internal.h"
+#include "streamvbyte_probes.h"
 #include <string.h> // for memcpy
 
+// the kernels used by the encoder and the decoder, for the probes
+#ifdef __AVX__
+#define SVB_KERNEL_PATH SVB_PATH_AVX
+#elif defined(__ARM_NEON__)
+#define SVB_KERNEL_PATH SVB_PATH_NEON
+#else
+#define SVB_KERNEL_PATH SVB_PATH_SCALAR
+#endif
+
 
 static uint8_t _encode_data(uint32_t val, uint8_t *__restrict__ *dataPtrPtr) {
   uint8_t *dataPtr = *dataPtrPtr;
@@ -56,13 +68,13 @@ static uint8_t _encode_data(uint32_t val, uint8_t *__restrict__ *dataPtrPtr) {
 static uint8_t *svb_encode_scalar(const uint32_t *in,
                                   uint8_t *__restrict__ keyPtr,
                                   uint8_t *__restrict__ dataPtr,
-                                  uint32_t count) {
+                                  size_t count) {
   if (count == 0)
     return dataPtr; // exit immediately if no data
 
   uint8_t shift = 0; // cycles 0, 2, 4, 6, 0, 2, 4, 6, ...
   uint8_t key = 0;
-  for (uint32_t c = 0; c < count; c++) {
+  for (size_t c = 0; c < count; c++) {
     if (shift == 8) {
       shift = 0;
       *keyPtr++ = key;
@@ -80,6 +92,7 @@ static uint8_t *svb_encode_scalar(const uint32_t *in,
 
 #ifdef __ARM_NEON__
 
+#define SVB_ENCODING_SHUFFLE_TABLE
 #include "streamvbyte_shuffle_tables.h"
 static const uint8_t pgatherlo[] = {12, 8, 4, 0, 12, 8, 4, 0}; // apparently only used in streamvbyte_encode4
 #define concat (1 | 1 << 10 | 1 << 20 | 1 << 30)
@@ -135,6 +148,38 @@ static inline size_t streamvbyte_encode_quad( uint32_t *__restrict__ in, uint8_t
   return streamvbyte_encode4(inq, outData, outCode);
 }
 
+#ifdef __aarch64__
+static const int8_t pkeyshifts[8] = {0, 2, 4, 6, 0, 2, 4, 6};
+
+// encodes 8 integers (two quads) at once: the 8 lane codes are narrowed to
+// bytes and packed into the two keys with one shift and two pairwise adds
+static inline size_t streamvbyte_encode8(const uint32_t *__restrict__ in, uint8_t *__restrict__ outData, uint8_t *__restrict__ outCode) {
+  uint32x4_t datalo = vld1q_u32(in);
+  uint32x4_t datahi = vld1q_u32(in + 4);
+
+  // lane code is 3 - (saturating sub) (clz(data)/8)
+  uint32x4_t codeslo = vqsubq_u32(vdupq_n_u32(3), vshrq_n_u32(vclzq_u32(datalo), 3));
+  uint32x4_t codeshi = vqsubq_u32(vdupq_n_u32(3), vshrq_n_u32(vclzq_u32(datahi), 3));
+  uint8x8_t codes = vmovn_u16(vcombine_u16(vmovn_u32(codeslo), vmovn_u32(codeshi)));
+
+  // [c0 c1<<2 c2<<4 c3<<6 c4 c5<<2 c6<<4 c7<<6] summed pairwise twice
+  uint8x8_t shifted = vshl_u8(codes, vld1_s8(pkeyshifts));
+  uint32x2_t keys = vpaddl_u16(vpaddl_u8(shifted));
+  uint32_t codelo = vget_lane_u32(keys, 0);
+  uint32_t codehi = vget_lane_u32(keys, 1);
+  size_t lengthlo = lengthTable[codelo];
+
+  uint8x16_t encodingShuffle = vld1q_u8((uint8_t *) &encodingShuffleTable[codelo]);
+  vst1q_u8(outData, vqtbl1q_u8(vreinterpretq_u8_u32(datalo), encodingShuffle));
+  encodingShuffle = vld1q_u8((uint8_t *) &encodingShuffleTable[codehi]);
+  vst1q_u8(outData + lengthlo, vqtbl1q_u8(vreinterpretq_u8_u32(datahi), encodingShuffle));
+
+  outCode[0] = (uint8_t) codelo;
+  outCode[1] = (uint8_t) codehi;
+  return lengthlo + lengthTable[codehi];
+}
+#endif
+
 #ifdef __aarch64__
 typedef uint8x16_t decode_t;
 #else
@@ -177,8 +222,56 @@ static void streamvbyte_decode_quad( const uint8_t * restrict *dataPtrPtr, uint8
 #endif
 }
 
-static const uint8_t *svb_decode_vector(uint32_t *out, const uint8_t *keyPtr, const uint8_t *dataPtr, uint32_t count) {
-  for(uint32_t i = 0; i < count/4; i++) 
+#ifdef __aarch64__
+// decodes the 8 quads whose keys are packed in "keys": the lengths only
+// depend on the keys, so the 8 data addresses are computed up front and
+// the loads and table lookups of the quads do not wait on one another
+static inline const uint8_t *_decode_neon_keys(uint64_t keys, uint32_t *out, const uint8_t *dataPtr) {
+  const uint8_t *dataPtrs[8];
+  for (int i = 0; i < 8; i++) {
+    dataPtrs[i] = dataPtr;
+    dataPtr += lengthTable[(keys >> (8 * i)) & 0xFF];
+  }
+  for (int i = 0; i < 8; i++) {
+    uint8x16_t decodingShuffle = vld1q_u8(shuffleTable[(keys >> (8 * i)) & 0xFF]);
+    uint8x16_t compressed = vld1q_u8(dataPtrs[i]);
+    vst1q_u8((uint8_t *) (out + 4 * i), vqtbl1q_u8(compressed, decodingShuffle));
+  }
+  return dataPtr;
+}
+
+// true if the 8 quads described by "keys" share the same key
+static inline int _uniform_keys(uint64_t keys) {
+  return keys == (keys & 0xFF) * UINT64_C(0x0101010101010101);
+}
+
+// decodes 8 quads sharing the same key with a single table lookup
+static inline const uint8_t *_decode_neon_uniform(uint64_t keys, uint32_t *out, const uint8_t *dataPtr) {
+  uint32_t key = keys & 0xFF;
+  size_t len = lengthTable[key];
+  uint8x16_t decodingShuffle = vld1q_u8(shuffleTable[key]);
+  for (int i = 0; i < 8; i++) {
+    uint8x16_t compressed = vld1q_u8(dataPtr + i * len);
+    vst1q_u8((uint8_t *) (out + 4 * i), vqtbl1q_u8(compressed, decodingShuffle));
+  }
+  return dataPtr + 8 * len;
+}
+#endif
+
+static const uint8_t *svb_decode_vector(uint32_t *out, const uint8_t *keyPtr, const uint8_t *dataPtr, size_t count) {
+  size_t i = 0;
+#ifdef __aarch64__
+  // 8 control bytes (32 integers) at a time, as in svb_decode_avx_simple
+  for(; i + 8 <= count/4; i += 8) {
+    uint64_t keys;
+    memcpy(&keys, keyPtr + i, sizeof(keys));
+    if (_uniform_keys(keys))
+      dataPtr = _decode_neon_uniform(keys, out + 4*i, dataPtr);
+    else
+      dataPtr = _decode_neon_keys(keys, out + 4*i, dataPtr);
+  }
+#endif
+  for(; i < count/4; i++) 
     streamvbyte_decode_quad( &dataPtr, keyPtr[i], out + 4*i );
 
   return dataPtr;
@@ -221,28 +314,55 @@ size_t streamvbyte_encode_quad( uint32_t *in, uint8_t *outData, uint8_t *outKey)
 
 #endif
 
-// Encode an array of a given length read from in to bout in streamvbyte format.
-// Returns the number of bytes written.
-size_t streamvbyte_encode(uint32_t *in, uint32_t count, uint8_t *out) {
-  uint8_t *keyPtr = out;
-  uint32_t keyLen = (count + 3) / 4;  // 2-bits rounded to full byte
-  uint8_t *dataPtr = keyPtr + keyLen; // variable byte data after all keys
-
+// Encode count values read from in, writing the keys to keyPtr and the data
+// bytes to dataPtr. Returns a pointer to the first unused data byte.
+// Also used by the other translation units to encode slices of a stream.
+uint8_t *svb_encode(const uint32_t *in, uint8_t *__restrict__ keyPtr,
+                    uint8_t *__restrict__ dataPtr, size_t count) {
 #if defined(__AVX__) || defined(__ARM_NEON__)
 
-  uint32_t count_quads = count / 4;
+  // The vectorized kernel stores 16 bytes even when the quad needs as few as
+  // 4, up to 12 bytes past its data. We only use it while at least 12 more
+  // integers follow (so at least 12 more data bytes overwrite the excess),
+  // and finish with the scalar code: no byte past the end of the compressed
+  // data is ever written.
+  size_t count_quads = count >= 16 ? (count - 12) / 4 : 0;
   count -= 4 * count_quads;
 
-  for (uint32_t c = 0; c < count_quads; c++) {
-    dataPtr += streamvbyte_encode_quad(in, dataPtr, keyPtr);
+  size_t c = 0;
+#if defined(__ARM_NEON__) && defined(__aarch64__)
+  for (; c + 2 <= count_quads; c += 2) {
+    dataPtr += streamvbyte_encode8(in, dataPtr, keyPtr);
+    keyPtr += 2;
+    in += 8;
+  }
+#endif
+  for (; c < count_quads; c++) {
+    dataPtr += streamvbyte_encode_quad((uint32_t *)in, dataPtr, keyPtr);
     keyPtr++;
     in += 4;
   }
 
 #endif
 
-  return svb_encode_scalar(in, keyPtr, dataPtr, count) - out;
+  return svb_encode_scalar(in, keyPtr, dataPtr, count);
+}
+
+// Encode an array of a given length read from in to bout in streamvbyte format.
+// Returns the number of bytes written.
+size_t streamvbyte_encode64(const uint32_t *in, size_t count, uint8_t *out) {
+  SVB_PROBE1(encode_entry, count);
+  uint8_t *keyPtr = out;
+  size_t keyLen = count / 4 + (count % 4 != 0); // 2-bits rounded to full byte
+  uint8_t *dataPtr = keyPtr + keyLen; // variable byte data after all keys
+
+  size_t bytes = svb_encode(in, keyPtr, dataPtr, count) - out;
+  SVB_PROBE3(encode_return, count, bytes, SVB_KERNEL_PATH);
+  return bytes;
+}
 
+size_t streamvbyte_encode(uint32_t *in, uint32_t count, uint8_t *out) {
+  return streamvbyte_encode64(in, count, out);
 }
 
 #ifdef __AVX__ // though we do not require AVX per se, it is a macro that MSVC
@@ -252,7 +372,7 @@ static inline __m128i _decode_avx(uint32_t key,
                                   const uint8_t *__restrict__ *dataPtrPtr) {
   uint8_t len;
   __m128i Data = _mm_loadu_si128((__m128i *)*dataPtrPtr);
-  uint8_t *pshuf = &shuffleTable[key];
+  uint8_t *pshuf = shuffleTable[key];
   __m128i Shuf = *(__m128i *)pshuf;
 #ifdef AVOIDLENGTHLOOKUP
   // this avoids the dependency on lengthTable, 
@@ -295,15 +415,18 @@ static inline uint32_t _decode_data(const uint8_t **dataPtrPtr, uint8_t code) {
   *dataPtrPtr = dataPtr;
   return val;
 }
-static const uint8_t *svb_decode_scalar(uint32_t *outPtr, const uint8_t *keyPtr,
-                                        const uint8_t *dataPtr,
-                                        uint32_t count) {
+
+// Same as svb_decode without vector loads: no byte past the data of the count
+// values is read.
+// Also used by the other translation units to decode the end of a stream.
+const uint8_t *svb_decode_scalar(uint32_t *outPtr, const uint8_t *keyPtr,
+                                 const uint8_t *dataPtr, size_t count) {
   if (count == 0)
     return dataPtr; // no reads or writes if no data
 
   uint8_t shift = 0;
   uint32_t key = *keyPtr++;
-  for (uint32_t c = 0; c < count; c++) {
+  for (size_t c = 0; c < count; c++) {
     if (shift == 8) {
       shift = 0;
       key = *keyPtr++;
@@ -318,77 +441,123 @@ static const uint8_t *svb_decode_scalar(uint32_t *outPtr, const uint8_t *keyPtr,
 #ifdef __AVX__ // though we do not require AVX per se, it is a macro that MSVC
                // will issue
 
+// decodes the 8 quads whose keys are packed in "keys"
+static inline const uint8_t *_decode_avx_keys(uint64_t keys, uint32_t *out,
+                                              const uint8_t *dataPtr) {
+  __m128i Data;
+  Data = _decode_avx((keys & 0xFF), &dataPtr);
+  _write_avx(out, Data);
+  Data = _decode_avx((keys & 0xFF00) >> 8, &dataPtr);
+  _write_avx(out + 4, Data);
+
+  keys >>= 16;
+  Data = _decode_avx((keys & 0xFF), &dataPtr);
+  _write_avx(out + 8, Data);
+  Data = _decode_avx((keys & 0xFF00) >> 8, &dataPtr);
+  _write_avx(out + 12, Data);
+
+  keys >>= 16;
+  Data = _decode_avx((keys & 0xFF), &dataPtr);
+  _write_avx(out + 16, Data);
+  Data = _decode_avx((keys & 0xFF00) >> 8, &dataPtr);
+  _write_avx(out + 20, Data);
+
+  keys >>= 16;
+  Data = _decode_avx((keys & 0xFF), &dataPtr);
+  _write_avx(out + 24, Data);
+  Data = _decode_avx((keys & 0xFF00) >> 8, &dataPtr);
+  _write_avx(out + 28, Data);
+  return dataPtr;
+}
+
+#ifdef PRECOMPUTEOFFSETS
+// the data lengths of the 8 quads described by "keys", one per byte: 4 plus
+// the sum of the 4 codes of the key (from 4 to 16)
+static inline uint64_t _quad_lengths(uint64_t keys) {
+  uint64_t pairs = (keys & UINT64_C(0x3333333333333333)) +
+                   ((keys >> 2) & UINT64_C(0x3333333333333333));
+  uint64_t sums = (pairs & UINT64_C(0x0F0F0F0F0F0F0F0F)) +
+                  ((pairs >> 4) & UINT64_C(0x0F0F0F0F0F0F0F0F));
+  return sums + UINT64_C(0x0404040404040404);
+}
+
+// decodes the 8 quads whose keys are packed in "keys", computing the offsets
+// of their data first: the multiplication sums the lengths of the quads
+// within the 64-bit word (byte i gets the total length of quads 0 to i, at
+// most 128, so the bytes do not overflow). The 8 loads only depend on
+// dataPtr, and dataPtr on the previous key word.
+static inline const uint8_t *_decode_avx_offsets(uint64_t keys, uint32_t *out,
+                                                 const uint8_t *dataPtr) {
+  uint64_t ends = _quad_lengths(keys) * UINT64_C(0x0101010101010101);
+  uint64_t starts = ends << 8;
+  for (int i = 0; i < 8; i++) {
+    __m128i Data =
+        _mm_loadu_si128((__m128i *)(dataPtr + ((starts >> (8 * i)) & 0xFF)));
+    __m128i Shuf = *(__m128i *)&shuffleTable[(keys >> (8 * i)) & 0xFF];
+    _write_avx(out + 4 * i, _mm_shuffle_epi8(Data, Shuf));
+  }
+  return dataPtr + (ends >> 56);
+}
+#endif
+
+// true if the 8 quads described by "keys" share the same key, in
+// particular if all 32 integers have the same byte length
+static inline int _uniform_keys(uint64_t keys) {
+  return keys == (keys & 0xFF) * UINT64_C(0x0101010101010101);
+}
+
+// decodes 8 quads sharing the same key: the shuffle and the length are
+// loaded once and the data offsets are known in advance, so the 8 loads
+// do not wait on one another
+static inline const uint8_t *_decode_avx_uniform(uint64_t keys, uint32_t *out,
+                                                 const uint8_t *dataPtr) {
+  uint32_t key = keys & 0xFF;
+  size_t len = lengthTable[key];
+  __m128i Shuf = *(__m128i *)&shuffleTable[key];
+  for (int i = 0; i < 8; i++) {
+    __m128i Data = _mm_loadu_si128((__m128i *)(dataPtr + i * len));
+    _write_avx(out + 4 * i, _mm_shuffle_epi8(Data, Shuf));
+  }
+  return dataPtr + 8 * len;
+}
+
+// Decodes count & ~31 integers, one 64-bit key word (8 quads) at a time.
+// The strategy is chosen at run time from a single statistic of each key
+// word: whether its 8 keys are equal (runs of integers of the same byte
+// length, typical of small values). Such words are decoded by
+// _decode_avx_uniform, the others by the table-driven _decode_avx_keys. The
+// test is a multiply and a compare, and the branch is well predicted unless
+// the data alternates between the two kinds of words.
+// The other strategies are compile-time options, not run-time choices:
+// neither was faster than _decode_avx_keys on any key distribution we
+// measured (from 4 random byte lengths to runs of 1-byte integers), so a
+// selector based on the keys would never pick them.
+// - AVOIDLENGTHLOOKUP derives the lengths from the shuffle rows instead of
+//   lengthTable (see _decode_avx): 10% to 2x slower on mixed keys.
+// - PRECOMPUTEOFFSETS replaces _decode_avx_keys by _decode_avx_offsets,
+//   which computes the 8 data offsets before any load. With
+//   _decode_avx_keys, the length lookups only depend on the keys, so the
+//   chain from one quad to the next is a single add: both run within a few
+//   percent of each other. make unit_precomputeoffsets builds the unit tests
+//   with it.
 const uint8_t *svb_decode_avx_simple(uint32_t *out,
                                      const uint8_t *__restrict__ keyPtr,
                                      const uint8_t *__restrict__ dataPtr,
                                      uint64_t count) {
-
-  uint64_t keybytes = count / 4; // number of key bytes
-  __m128i Data;
-  if (keybytes >= 8) {
-
-    int64_t Offset = -(int64_t)keybytes / 8 + 1;
-
-    const uint64_t *keyPtr64 = (const uint64_t *)keyPtr - Offset;
-    uint64_t nextkeys;
-    memcpy(&nextkeys, keyPtr64 + Offset, sizeof(nextkeys));
-    for (; Offset != 0; ++Offset) {
-      uint64_t keys = nextkeys;
-      memcpy(&nextkeys, keyPtr64 + Offset + 1, sizeof(nextkeys));
-
-      Data = _decode_avx((keys & 0xFF), &dataPtr);
-      _write_avx(out, Data);
-      Data = _decode_avx((keys & 0xFF00) >> 8, &dataPtr);
-      _write_avx(out + 4, Data);
-
-      keys >>= 16;
-      Data = _decode_avx((keys & 0xFF), &dataPtr);
-      _write_avx(out + 8, Data);
-      Data = _decode_avx((keys & 0xFF00) >> 8, &dataPtr);
-      _write_avx(out + 12, Data);
-
-      keys >>= 16;
-      Data = _decode_avx((keys & 0xFF), &dataPtr);
-      _write_avx(out + 16, Data);
-      Data = _decode_avx((keys & 0xFF00) >> 8, &dataPtr);
-      _write_avx(out + 20, Data);
-
-      keys >>= 16;
-      Data = _decode_avx((keys & 0xFF), &dataPtr);
-      _write_avx(out + 24, Data);
-      Data = _decode_avx((keys & 0xFF00) >> 8, &dataPtr);
-      _write_avx(out + 28, Data);
-
-      out += 32;
-    }
-    {
-      uint64_t keys = nextkeys;
-
-      Data = _decode_avx((keys & 0xFF), &dataPtr);
-      _write_avx(out, Data);
-      Data = _decode_avx((keys & 0xFF00) >> 8, &dataPtr);
-      _write_avx(out + 4, Data);
-
-      keys >>= 16;
-      Data = _decode_avx((keys & 0xFF), &dataPtr);
-      _write_avx(out + 8, Data);
-      Data = _decode_avx((keys & 0xFF00) >> 8, &dataPtr);
-      _write_avx(out + 12, Data);
-
-      keys >>= 16;
-      Data = _decode_avx((keys & 0xFF), &dataPtr);
-      _write_avx(out + 16, Data);
-      Data = _decode_avx((keys & 0xFF00) >> 8, &dataPtr);
-      _write_avx(out + 20, Data);
-
-      keys >>= 16;
-      Data = _decode_avx((keys & 0xFF), &dataPtr);
-      _write_avx(out + 24, Data);
-      Data = _decode_avx((keys & 0xFF00) >> 8, &dataPtr);
-      _write_avx(out + 28, Data);
-
-      out += 32;
-    }
+  uint64_t keywords = count / 32; // number of 64-bit key words
+
+  for (uint64_t w = 0; w < keywords; w++) {
+    uint64_t keys;
+    memcpy(&keys, keyPtr + 8 * w, sizeof(keys));
+    if (_uniform_keys(keys))
+      dataPtr = _decode_avx_uniform(keys, out, dataPtr);
+    else
+#ifdef PRECOMPUTEOFFSETS
+      dataPtr = _decode_avx_offsets(keys, out, dataPtr);
+#else
+      dataPtr = _decode_avx_keys(keys, out, dataPtr);
+#endif
+    out += 32;
   }
 
   return dataPtr;
@@ -396,16 +565,11 @@ const uint8_t *svb_decode_avx_simple(uint32_t *out,
 
 #endif
 
-// Read count 32-bit integers in maskedvbyte format from in, storing the result
-// in out.  Returns the number of bytes read.
-size_t streamvbyte_decode(const uint8_t *in, uint32_t *out, uint32_t count) {
-  if (count == 0)
-    return 0;
-
-  const uint8_t *keyPtr = in;               // full list of keys is next
-  uint32_t keyLen = ((count + 3) / 4);      // 2-bits per key (rounded up)
-  const uint8_t *dataPtr = keyPtr + keyLen; // data starts at end of keys
-
+// Decode count values whose keys start at keyPtr and whose data bytes start
+// at dataPtr. Returns a pointer to the first unused data byte.
+// Also used by the other translation units to decode slices of a stream.
+const uint8_t *svb_decode(uint32_t *out, const uint8_t *keyPtr,
+                          const uint8_t *dataPtr, size_t count) {
 #ifdef __AVX__
   dataPtr = svb_decode_avx_simple(out, keyPtr, dataPtr, count);
   out += count & ~ 31;
@@ -418,6 +582,38 @@ size_t streamvbyte_decode(const uint8_t *in, uint32_t *out, uint32_t count) {
   count &= 3;
 #endif
 
-  return svb_decode_scalar(out, keyPtr, dataPtr, count) - in;
+  return svb_decode_scalar(out, keyPtr, dataPtr, count);
+}
 
+size_t streamvbyte_compressedbytes64(const uint32_t *in, size_t length) {
+  size_t bytes = length / 4 + (length % 4 != 0); // number of control bytes
+  for (size_t c = 0; c < length; c++) {
+    uint32_t val = in[c];
+    bytes += 1 + (val > 0xFF) + (val > 0xFFFF) + (val > 0xFFFFFF);
+  }
+  return bytes;
+}
+
+size_t streamvbyte_compressedbytes(const uint32_t *in, uint32_t length) {
+  return streamvbyte_compressedbytes64(in, length);
+}
+
+// Read count 32-bit integers in maskedvbyte format from in, storing the result
+// in out.  Returns the number of bytes read.
+size_t streamvbyte_decode64(const uint8_t *in, uint32_t *out, size_t count) {
+  SVB_PROBE1(decode_entry, count);
+  size_t bytes = 0;
+  if (count > 0) {
+    const uint8_t *keyPtr = in;               // full list of keys is next
+    size_t keyLen = count / 4 + (count % 4 != 0); // 2-bits per key (rounded up)
+    const uint8_t *dataPtr = keyPtr + keyLen; // data starts at end of keys
+
+    bytes = svb_decode(out, keyPtr, dataPtr, count) - in;
+  }
+  SVB_PROBE3(decode_return, count, bytes, SVB_KERNEL_PATH);
+  return bytes;
+}
+
+size_t streamvbyte_decode(const uint8_t *in, uint32_t *out, uint32_t count) {
+  return streamvbyte_decode64(in, out, count);
 }
@@ -0,0 +1,105 @@
+#ifndef STREAMVBYTE_DELTA_KERNELS_H_
+#define STREAMVBYTE_DELTA_KERNELS_H_
+
+// Decoding kernels of the differential format (a quad of integers from its
+// key, prefix sums over 4, 8 or 16 lanes), shared by streamvbytedelta.c and
+// the modules decoding differential streams in their own loops
+// (streamvbytepostings.c). Include the intrinsics and
+// streamvbyte_shuffle_tables.h first.
+
+#ifdef __AVX__
+static inline __m128i _decode_avx(uint32_t key,
+                                  const uint8_t *__restrict__ *dataPtrPtr) {
+  uint8_t len = lengthTable[key];
+  __m128i Data = _mm_loadu_si128((__m128i *)*dataPtrPtr);
+  __m128i Shuf = *(__m128i *)&shuffleTable[key];
+
+  Data = _mm_shuffle_epi8(Data, Shuf);
+  *dataPtrPtr += len;
+
+  return Data;
+}
+#define BroadcastLastXMM 0xFF // bits 0-7 all set to choose highest element
+
+static inline void _write_avx(uint32_t *out, __m128i Vec) {
+  _mm_storeu_si128((__m128i *)out, Vec);
+}
+
+static inline __m128i _prefix_avx_d1(__m128i Vec, __m128i Prev) {
+  __m128i Add = _mm_slli_si128(Vec, 4); // Cycle 1: [- A B C] (already done)
+  Prev = _mm_shuffle_epi32(Prev, BroadcastLastXMM); // Cycle 2: [P P P P]
+  Vec = _mm_add_epi32(Vec, Add);                    // Cycle 2: [A AB BC CD]
+  Add = _mm_slli_si128(Vec, 8);                     // Cycle 3: [- - A AB]
+  Vec = _mm_add_epi32(Vec, Prev);                   // Cycle 3: [PA PAB PBC PCD]
+  return _mm_add_epi32(Vec, Add); // Cycle 4: [PA PAB PABC PABCD]
+}
+
+static __m128i _write_avx_d1(uint32_t *out, __m128i Vec, __m128i Prev) {
+  Vec = _prefix_avx_d1(Vec, Prev);
+  _write_avx(out, Vec);
+  return Vec;
+}
+
+static inline __m128i _write_16bit_avx_d1(uint32_t *out, __m128i Vec,
+                                          __m128i Prev) {
+  const __m128i High16To32 =
+      _mm_set_epi8(-1, -1, 15, 14, -1, -1, 13, 12, -1, -1, 11, 10, -1, -1, 9, 8);
+  // vec == [A B C D E F G H] (16 bit values)
+  __m128i Add = _mm_slli_si128(Vec, 2);             // [- A B C D E F G]
+  Prev = _mm_shuffle_epi32(Prev, BroadcastLastXMM); // [P P P P] (32-bit)
+  Vec = _mm_add_epi32(Vec, Add);                    // [A AB BC CD DE FG GH]
+  Add = _mm_slli_si128(Vec, 4);                     // [- - A AB BC CD DE EF]
+  Vec = _mm_add_epi32(Vec, Add);        // [A AB ABC ABCD BCDE CDEF DEFG EFGH]
+  __m128i V1 = _mm_cvtepu16_epi32(Vec); // [A AB ABC ABCD] (32-bit)
+  V1 = _mm_add_epi32(V1, Prev);         // [PA PAB PABC PABCD] (32-bit)
+  __m128i V2 =
+      _mm_shuffle_epi8(Vec, High16To32); // [BCDE CDEF DEFG EFGH] (32-bit)
+  V2 = _mm_add_epi32(V1, V2); // [PABCDE PABCDEF PABCDEFG PABCDEFGH] (32-bit)
+  _write_avx(out, V1);
+  _write_avx(out + 4, V2);
+  return V2;
+}
+
+#ifdef __AVX2__
+// decodes the two quads described by the low 16 bits of keys into a ymm
+static inline __m256i _decode_avx2(uint64_t keys,
+                                   const uint8_t *__restrict__ *dataPtrPtr) {
+  __m128i Data0 = _decode_avx(keys & 0x00FF, dataPtrPtr);
+  __m128i Data1 = _decode_avx((keys & 0xFF00) >> 8, dataPtrPtr);
+  return _mm256_inserti128_si256(_mm256_castsi128_si256(Data0), Data1, 1);
+}
+
+static inline __m256i _write_avx2_d1(uint32_t *out, __m256i Vec,
+                                     __m256i Prev) {
+  // vec == [A B C D | E F G H], Prev == [P P P P P P P P]
+  Vec = _mm256_add_epi32(Vec, _mm256_slli_si256(Vec, 4)); // [A AB BC CD | E EF FG GH]
+  Vec = _mm256_add_epi32(Vec, _mm256_slli_si256(Vec, 8)); // [A AB ABC ABCD | E EF EFG EFGH]
+  // cross-lane carry, independent of Prev
+  __m256i Carry = _mm256_shuffle_epi32(Vec, BroadcastLastXMM); // [ABCD.. | EFGH..]
+  Carry = _mm256_permute2x128_si256(Carry, Carry, 0x08); // [0 0 0 0 | ABCD ABCD ABCD ABCD]
+  Vec = _mm256_add_epi32(Vec, _mm256_add_epi32(Carry, Prev)); // [PA .. PABCD | PABCDE .. PABCDEFGH]
+  _mm256_storeu_si256((__m256i *)out, Vec);
+  return _mm256_permutevar8x32_epi32(Vec, _mm256_set1_epi32(7));
+}
+
+static inline __m256i _write_16bit_avx2_d1(uint32_t *out, __m256i Vec,
+                                           __m256i Prev) {
+  // vec == [A B C D E F G H | I J K L M N O P] (16 bit values)
+  Vec = _mm256_add_epi16(Vec, _mm256_slli_si256(Vec, 2)); // [A AB BC CD DE EF FG GH | ..]
+  Vec = _mm256_add_epi16(Vec, _mm256_slli_si256(Vec, 4)); // [A AB ABC ABCD BCDE CDEF DEFG EFGH | ..]
+  Vec = _mm256_add_epi16(Vec, _mm256_slli_si256(Vec, 8)); // [A .. ABCDEFGH | I .. IJKLMNOP]
+  __m256i V1 = _mm256_cvtepu16_epi32(_mm256_castsi256_si128(Vec)); // [A .. ABCDEFGH] (32-bit)
+  __m256i V2 = _mm256_cvtepu16_epi32(_mm256_extracti128_si256(Vec, 1)); // [I .. IJKLMNOP] (32-bit)
+  // cross-lane carry, independent of Prev
+  __m256i Carry = _mm256_permutevar8x32_epi32(V1, _mm256_set1_epi32(7)); // [ABCDEFGH ..]
+  V1 = _mm256_add_epi32(V1, Prev); // [PA .. PABCDEFGH]
+  V2 = _mm256_add_epi32(V2, _mm256_add_epi32(Carry, Prev)); // [PABCDEFGHI .. PABCDEFGHIJKLMNOP]
+  _mm256_storeu_si256((__m256i *)out, V1);
+  _mm256_storeu_si256((__m256i *)(out + 8), V2);
+  return _mm256_permutevar8x32_epi32(V2, _mm256_set1_epi32(7));
+}
+#endif
+
+#endif
+
+#endif /* STREAMVBYTE_DELTA_KERNELS_H_ */
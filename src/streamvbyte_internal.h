@@ -0,0 +1,39 @@
+#ifndef STREAMVBYTE_INTERNAL_H_
+#define STREAMVBYTE_INTERNAL_H_
+
+// The kernels of streamvbyte.c and streamvbytedelta.c that the other
+// translation units use to encode or decode slices of a stream: the keys and
+// the data bytes are given separately, and they fire no probe (see
+// streamvbyte_probes.h).
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __AVX__
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+#endif
+
+// from streamvbyte.c
+uint8_t *svb_encode(const uint32_t *in, uint8_t *__restrict__ keyPtr,
+                    uint8_t *__restrict__ dataPtr, size_t count);
+const uint8_t *svb_decode(uint32_t *out, const uint8_t *keyPtr,
+                          const uint8_t *dataPtr, size_t count);
+const uint8_t *svb_decode_scalar(uint32_t *outPtr, const uint8_t *keyPtr,
+                                 const uint8_t *dataPtr, size_t count);
+#ifdef __AVX__
+size_t streamvbyte_encode4(__m128i in, uint8_t *outData, uint8_t *outCode);
+#endif
+
+// from streamvbytedelta.c
+uint8_t *svb_encode_d1(const uint32_t *in, uint8_t *__restrict__ keyPtr,
+                       uint8_t *__restrict__ dataPtr, size_t count,
+                       uint32_t prev);
+const uint8_t *svb_decode_d1(uint32_t *out, const uint8_t *keyPtr,
+                             const uint8_t *dataPtr, size_t count,
+                             uint32_t prev);
+
+#endif /* STREAMVBYTE_INTERNAL_H_ */
@@ -0,0 +1,41 @@
+#ifndef STREAMVBYTE_PROBES_H_
+#define STREAMVBYTE_PROBES_H_
+
+// Static tracepoints (USDT) of the "streamvbyte" provider, for tracing the
+// library in production with bpftrace, perf or SystemTap (see utils/bpftrace).
+// They are built in when <sys/sdt.h> is found (systemtap-sdt-dev on Debian,
+// systemtap-sdt-devel on Fedora) unless STREAMVBYTE_NO_PROBES is defined,
+// and compile to nothing otherwise. A probe site is a single nop instruction
+// until a tracer attaches to it, but its arguments are evaluated at every
+// call all the same: only pass values that are already at hand (as the
+// counts and constants below), never a computation made for the probe.
+//
+// For each of encode, decode, delta_encode and delta_decode:
+//   <name>_entry  (count)
+//   <name>_return (count, bytes, path)
+// where count is the number of integers, bytes the number of compressed bytes
+// written or read and path the kernel used (see SVB_PATH_SCALAR and below).
+// They only fire in the exported streamvbyte_* functions: the other modules
+// call the kernels declared in streamvbyte_internal.h, so that a call to the
+// library is not counted twice.
+
+#if !defined(STREAMVBYTE_NO_PROBES) && defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+#define SVB_PROBE1(name, a) DTRACE_PROBE1(streamvbyte, name, a)
+#define SVB_PROBE3(name, a, b, c) DTRACE_PROBE3(streamvbyte, name, a, b, c)
+#endif
+#endif
+
+#ifndef SVB_PROBE1
+#define SVB_PROBE1(name, a) ((void)0)
+#define SVB_PROBE3(name, a, b, c) ((void)0)
+#endif
+
+// values of the path argument
+#define SVB_PATH_SCALAR 0
+#define SVB_PATH_NEON 1
+#define SVB_PATH_AVX 2  // 128-bit vectors (SSE4.1 and SSSE3 through AVX)
+#define SVB_PATH_AVX2 3 // 256-bit vectors
+
+#endif /* STREAMVBYTE_PROBES_H_ */
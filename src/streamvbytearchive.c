@@ -0,0 +1,334 @@
+#include "streamvbytearchive.h"
+#include "streamvbyte.h"
+
+#include "streamvbyte_internal.h"
+#include <string.h> // for memcpy, memset
+
+#define SVB_ARCHIVE_RAW 0
+#define SVB_ARCHIVE_HUFFMAN 1
+// code lengths are limited so that a single table lookup decodes a key and
+// 4 keys fit in the bits available after a refill
+#define SVB_ARCHIVE_MAX_CODE_LENGTH 11
+#define SVB_ARCHIVE_TABLE_SIZE (1 << SVB_ARCHIVE_MAX_CODE_LENGTH)
+#define SVB_ARCHIVE_STREAMS 4
+#define SVB_ARCHIVE_HEADER (1 + 128 + 4 * SVB_ARCHIVE_STREAMS)
+// Keys are decoded into a scratch buffer of this many keys before the data
+// is decoded. Must be a multiple of 8 so that every chunk but the last fills
+// whole vectorized blocks of 32 integers.
+#define SVB_ARCHIVE_CHUNK 256
+
+// the control byte describing the (at most 4) integers starting at in
+static inline uint8_t _key(const uint32_t *in, size_t n) {
+  uint8_t key = 0;
+  for (size_t i = 0; i < n; i++) {
+    uint32_t val = in[i];
+    uint8_t code = (val > 0xFF) + (val > 0xFFFF) + (val > 0xFFFFFF);
+    key |= code << (2 * i);
+  }
+  return key;
+}
+
+// Huffman code lengths (at most SVB_ARCHIVE_MAX_CODE_LENGTH) for the given
+// frequencies, 0 for unused symbols. Speed does not matter here: there are
+// only 256 symbols.
+static void _code_lengths(const uint64_t *freq, uint8_t *lengths) {
+  uint64_t weight[512];
+  int parent[512];
+  int active[256];
+  int nactive = 0;
+  for (int s = 0; s < 256; s++) {
+    lengths[s] = 0;
+    weight[s] = freq[s];
+    parent[s] = -1;
+    if (freq[s] > 0)
+      active[nactive++] = s;
+  }
+  if (nactive == 0)
+    return;
+  if (nactive == 1) {
+    lengths[active[0]] = 1;
+    return;
+  }
+  // merge the two lightest nodes until one tree is left
+  int next = 256;
+  while (nactive > 1) {
+    int a = 0, b = 1;
+    if (weight[active[b]] < weight[active[a]]) {
+      a = 1;
+      b = 0;
+    }
+    for (int i = 2; i < nactive; i++) {
+      if (weight[active[i]] < weight[active[a]]) {
+        b = a;
+        a = i;
+      } else if (weight[active[i]] < weight[active[b]]) {
+        b = i;
+      }
+    }
+    weight[next] = weight[active[a]] + weight[active[b]];
+    parent[next] = -1;
+    parent[active[a]] = next;
+    parent[active[b]] = next;
+    // replace a by the new node and remove b
+    active[a] = next++;
+    active[b] = active[--nactive];
+  }
+  int maxlength = 0;
+  for (int s = 0; s < 256; s++) {
+    if (freq[s] == 0)
+      continue;
+    int depth = 0;
+    for (int n = s; parent[n] >= 0; n = parent[n])
+      depth++;
+    lengths[s] = depth > SVB_ARCHIVE_MAX_CODE_LENGTH ? SVB_ARCHIVE_MAX_CODE_LENGTH
+                                                    : depth;
+    if (depth > maxlength)
+      maxlength = depth;
+  }
+  if (maxlength <= SVB_ARCHIVE_MAX_CODE_LENGTH)
+    return;
+  // The truncated lengths violate the Kraft inequality: lengthen the codes
+  // of the rarest symbols among the longest ones that can still grow.
+  uint32_t kraft = 0;
+  for (int s = 0; s < 256; s++)
+    if (lengths[s] > 0)
+      kraft += SVB_ARCHIVE_TABLE_SIZE >> lengths[s];
+  while (kraft > SVB_ARCHIVE_TABLE_SIZE) {
+    int best = -1;
+    for (int s = 0; s < 256; s++) {
+      if (lengths[s] == 0 || lengths[s] == SVB_ARCHIVE_MAX_CODE_LENGTH)
+        continue;
+      if (best < 0 || lengths[s] > lengths[best] ||
+          (lengths[s] == lengths[best] && freq[s] < freq[best]))
+        best = s;
+    }
+    kraft -= SVB_ARCHIVE_TABLE_SIZE >> (lengths[best] + 1);
+    lengths[best]++;
+  }
+}
+
+// Canonical codes, bit-reversed since the bits are read from the least
+// significant end.
+static void _canonical_codes(const uint8_t *lengths, uint16_t *codes) {
+  uint16_t count[SVB_ARCHIVE_MAX_CODE_LENGTH + 1] = {0};
+  uint16_t next[SVB_ARCHIVE_MAX_CODE_LENGTH + 1];
+  for (int s = 0; s < 256; s++)
+    count[lengths[s]]++;
+  count[0] = 0;
+  uint16_t code = 0;
+  for (int l = 1; l <= SVB_ARCHIVE_MAX_CODE_LENGTH; l++) {
+    code = (code + count[l - 1]) << 1;
+    next[l] = code;
+  }
+  for (int s = 0; s < 256; s++) {
+    int l = lengths[s];
+    if (l == 0)
+      continue;
+    uint16_t c = next[l]++;
+    uint16_t reversed = 0;
+    for (int i = 0; i < l; i++)
+      reversed |= ((c >> i) & 1) << (l - 1 - i);
+    codes[s] = reversed;
+  }
+}
+
+typedef struct {
+  uint64_t bits;
+  unsigned count;
+  uint8_t *ptr;
+} svb_bit_writer_t;
+
+static inline void _put_bits(svb_bit_writer_t *w, uint32_t code,
+                             unsigned length) {
+  w->bits |= (uint64_t)code << w->count;
+  w->count += length;
+  while (w->count >= 8) {
+    *w->ptr++ = (uint8_t)w->bits;
+    w->bits >>= 8;
+    w->count -= 8;
+  }
+}
+
+static inline void _flush_bits(svb_bit_writer_t *w) {
+  if (w->count > 0)
+    *w->ptr++ = (uint8_t)w->bits;
+  w->bits = 0;
+  w->count = 0;
+}
+
+size_t streamvbyte_archive_encode(const uint32_t *in, uint32_t length,
+                                  uint8_t *out) {
+  size_t keyLen = ((size_t)length + 3) / 4; // 2-bits rounded to full byte
+
+  // first pass: how often each key occurs in each stream
+  uint64_t freq[256] = {0};
+  uint64_t streamfreq[SVB_ARCHIVE_STREAMS][256] = {{0}};
+  for (size_t k = 0; k < keyLen; k++) {
+    size_t n = length - 4 * k < 4 ? length - 4 * k : 4;
+    streamfreq[k % SVB_ARCHIVE_STREAMS][_key(in + 4 * k, n)]++;
+  }
+  for (int i = 0; i < SVB_ARCHIVE_STREAMS; i++)
+    for (int s = 0; s < 256; s++)
+      freq[s] += streamfreq[i][s];
+
+  uint8_t lengths[256];
+  _code_lengths(freq, lengths);
+  size_t streamsizes[SVB_ARCHIVE_STREAMS];
+  size_t huffmanLen = 0;
+  for (int i = 0; i < SVB_ARCHIVE_STREAMS; i++) {
+    uint64_t bits = 0;
+    for (int s = 0; s < 256; s++)
+      bits += streamfreq[i][s] * lengths[s];
+    streamsizes[i] = (bits + 7) / 8;
+    huffmanLen += streamsizes[i];
+  }
+
+  if (SVB_ARCHIVE_HEADER + huffmanLen >= 1 + keyLen) {
+    // not worth it: store the regular format
+    out[0] = SVB_ARCHIVE_RAW;
+    return 1 + (svb_encode(in, out + 1, out + 1 + keyLen, length) - (out + 1));
+  }
+
+  out[0] = SVB_ARCHIVE_HUFFMAN;
+  for (int s = 0; s < 256; s += 2)
+    out[1 + s / 2] = lengths[s] | (lengths[s + 1] << 4);
+  for (int i = 0; i < SVB_ARCHIVE_STREAMS; i++) {
+    uint32_t size = (uint32_t)streamsizes[i];
+    memcpy(out + 129 + 4 * i, &size, sizeof(size)); // assumes little endian
+  }
+
+  // second pass: the Huffman streams
+  uint16_t codes[256];
+  _canonical_codes(lengths, codes);
+  svb_bit_writer_t writers[SVB_ARCHIVE_STREAMS];
+  uint8_t *p = out + SVB_ARCHIVE_HEADER;
+  for (int i = 0; i < SVB_ARCHIVE_STREAMS; i++) {
+    writers[i].bits = 0;
+    writers[i].count = 0;
+    writers[i].ptr = p;
+    p += streamsizes[i];
+  }
+  for (size_t k = 0; k < keyLen; k++) {
+    size_t n = length - 4 * k < 4 ? length - 4 * k : 4;
+    uint8_t key = _key(in + 4 * k, n);
+    _put_bits(&writers[k % SVB_ARCHIVE_STREAMS], codes[key], lengths[key]);
+  }
+  for (int i = 0; i < SVB_ARCHIVE_STREAMS; i++)
+    _flush_bits(&writers[i]);
+
+  // third pass: the data bytes, the keys go to a scratch buffer
+  uint8_t keys[SVB_ARCHIVE_CHUNK];
+  for (size_t row = 0; row < length; row += 4 * SVB_ARCHIVE_CHUNK) {
+    size_t count = length - row;
+    if (count > 4 * SVB_ARCHIVE_CHUNK)
+      count = 4 * SVB_ARCHIVE_CHUNK;
+    p = svb_encode(in + row, keys, p, count);
+  }
+  return p - out;
+}
+
+typedef struct {
+  uint64_t bits;
+  unsigned count;
+  const uint8_t *ptr;
+  const uint8_t *end;
+} svb_bit_reader_t;
+
+// makes at least 56 bits available (or all the remaining bits)
+static inline void _refill(svb_bit_reader_t *r) {
+  if (r->end - r->ptr >= 8) {
+    uint64_t word;
+    memcpy(&word, r->ptr, sizeof(word)); // assumes little endian
+    r->bits |= word << r->count;
+    r->ptr += (63 - r->count) >> 3;
+    r->count |= 56;
+  } else {
+    while (r->count <= 56 && r->ptr < r->end) {
+      r->bits |= (uint64_t)*r->ptr++ << r->count;
+      r->count += 8;
+    }
+  }
+}
+
+// each entry holds the symbol in the high byte and the code length in the
+// low bits
+static inline uint8_t _decode_key(svb_bit_reader_t *r, const uint16_t *table) {
+  uint16_t entry = table[r->bits & (SVB_ARCHIVE_TABLE_SIZE - 1)];
+  unsigned length = entry & 0xF;
+  r->bits >>= length;
+  r->count -= length;
+  return (uint8_t)(entry >> 8);
+}
+
+// decodes n keys, key i coming from stream i % 4
+static void _decode_keys(svb_bit_reader_t *r, const uint16_t *table,
+                         uint8_t *keys, size_t n) {
+  size_t i = 0;
+  // 4 keys use at most 44 bits: one refill per reader for 16 keys, and the
+  // 4 readers have no dependency on each other
+  for (; i + 16 <= n; i += 16) {
+    _refill(&r[0]);
+    _refill(&r[1]);
+    _refill(&r[2]);
+    _refill(&r[3]);
+    for (size_t j = i; j < i + 16; j += 4) {
+      keys[j] = _decode_key(&r[0], table);
+      keys[j + 1] = _decode_key(&r[1], table);
+      keys[j + 2] = _decode_key(&r[2], table);
+      keys[j + 3] = _decode_key(&r[3], table);
+    }
+  }
+  for (; i < n; i++) {
+    _refill(&r[i % SVB_ARCHIVE_STREAMS]);
+    keys[i] = _decode_key(&r[i % SVB_ARCHIVE_STREAMS], table);
+  }
+}
+
+size_t streamvbyte_archive_decode(const uint8_t *in, uint32_t *out,
+                                  uint32_t length) {
+  if (in[0] == SVB_ARCHIVE_RAW) {
+    size_t keyLen = ((size_t)length + 3) / 4; // 2-bits per key (rounded up)
+    return 1 + (svb_decode(out, in + 1, in + 1 + keyLen, length) - (in + 1));
+  }
+
+  uint8_t lengths[256];
+  for (int s = 0; s < 256; s += 2) {
+    lengths[s] = in[1 + s / 2] & 0xF;
+    lengths[s + 1] = in[1 + s / 2] >> 4;
+  }
+  uint16_t codes[256];
+  _canonical_codes(lengths, codes);
+  uint16_t table[SVB_ARCHIVE_TABLE_SIZE];
+  memset(table, 0, sizeof(table));
+  for (int s = 0; s < 256; s++) {
+    int l = lengths[s];
+    if (l == 0)
+      continue;
+    // every index whose low l bits are the code decodes to s
+    for (int i = codes[s]; i < SVB_ARCHIVE_TABLE_SIZE; i += 1 << l)
+      table[i] = (uint16_t)(s << 8 | l);
+  }
+
+  svb_bit_reader_t readers[SVB_ARCHIVE_STREAMS];
+  const uint8_t *p = in + SVB_ARCHIVE_HEADER;
+  for (int i = 0; i < SVB_ARCHIVE_STREAMS; i++) {
+    uint32_t size;
+    memcpy(&size, in + 129 + 4 * i, sizeof(size)); // assumes little endian
+    readers[i].bits = 0;
+    readers[i].count = 0;
+    readers[i].ptr = p;
+    readers[i].end = p + size;
+    p += size;
+  }
+
+  // the data bytes follow the last stream
+  uint8_t keys[SVB_ARCHIVE_CHUNK];
+  for (size_t row = 0; row < length; row += 4 * SVB_ARCHIVE_CHUNK) {
+    size_t count = length - row;
+    if (count > 4 * SVB_ARCHIVE_CHUNK)
+      count = 4 * SVB_ARCHIVE_CHUNK;
+    _decode_keys(readers, table, keys, (count + 3) / 4);
+    p = svb_decode(out + row, keys, p, count);
+  }
+  return p - in;
+}
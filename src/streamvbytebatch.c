@@ -0,0 +1,142 @@
+#include "streamvbytebatch.h"
+#if defined(_MSC_VER)
+/* Microsoft C/C++-compatible compiler */
+#include <intrin.h>
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+/* GCC-compatible compiler, targeting x86/x86-64 */
+#include <x86intrin.h>
+#endif
+
+#include "streamvbyte_internal.h"
+#include <string.h> // for memcpy
+
+#if defined(__GNUC__)
+#define SVB_PREFETCH(p) __builtin_prefetch(p)
+#elif defined(_MSC_VER)
+#define SVB_PREFETCH(p) _mm_prefetch((const char *)(p), _MM_HINT_T0)
+#else
+#define SVB_PREFETCH(p) ((void)(p))
+#endif
+
+#define SVB_CACHE_LINE 64
+
+// number of data bytes of count integers described by keys
+static inline size_t _data_length(const uint8_t *keys, size_t count) {
+  size_t length = count; // the padding codes of the last key are zero
+  size_t keyLen = (count + 3) / 4;
+  size_t k = 0;
+#if defined(__GNUC__)
+  // the codes are the sum of their low bits plus twice their high bits
+  for (; k + 8 <= keyLen; k += 8) {
+    uint64_t w;
+    memcpy(&w, keys + k, sizeof(w));
+    length += __builtin_popcountll(w & UINT64_C(0x5555555555555555)) +
+              2 * __builtin_popcountll(w & UINT64_C(0xAAAAAAAAAAAAAAAA));
+  }
+#endif
+  for (; k < keyLen; k++)
+    length += (keys[k] & 3) + ((keys[k] >> 2) & 3) + ((keys[k] >> 4) & 3) +
+              (keys[k] >> 6);
+  return length;
+}
+
+static inline void _prefetch_range(const uint8_t *begin, size_t length) {
+  // every line holding one of the bytes, including the last one
+  uintptr_t first = (uintptr_t)begin / SVB_CACHE_LINE;
+  uintptr_t last = ((uintptr_t)begin + length - 1) / SVB_CACHE_LINE;
+  for (uintptr_t line = first; line <= last; line++)
+    SVB_PREFETCH(begin + (line - first) * SVB_CACHE_LINE);
+}
+
+// the steps of a stream in flight: each one prefetches what the next reads
+enum { SVB_BATCH_KEYS, SVB_BATCH_DATA, SVB_BATCH_DECODE };
+
+typedef struct {
+  int step;
+  const uint8_t *in;
+  const uint8_t *keyPtr;
+  const uint8_t *dataPtr;
+  uint32_t *out;
+  size_t remaining;
+  uint32_t prev;
+} svb_batch_state_t;
+
+static inline void _start(svb_batch_state_t *s, const streamvbyte_batch_t *list) {
+  size_t keyLen = ((size_t)list->length + 3) / 4; // 2-bits per key (rounded up)
+  s->step = SVB_BATCH_KEYS;
+  s->in = list->in;
+  s->keyPtr = list->in;
+  s->dataPtr = list->in + keyLen;
+  s->out = list->out;
+  s->remaining = list->length;
+  s->prev = list->prev;
+}
+
+// advance s by one step, returns the number of bytes read once the stream
+// is over, 0 otherwise
+static inline size_t _step(svb_batch_state_t *s, int delta) {
+  size_t count = s->remaining < STREAMVBYTE_BATCH_CHUNK ? s->remaining
+                                                        : STREAMVBYTE_BATCH_CHUNK;
+  switch (s->step) {
+  case SVB_BATCH_KEYS:
+    _prefetch_range(s->keyPtr, (count + 3) / 4);
+    s->step = SVB_BATCH_DATA;
+    return 0;
+  case SVB_BATCH_DATA:
+    _prefetch_range(s->dataPtr, _data_length(s->keyPtr, count));
+    s->step = SVB_BATCH_DECODE;
+    return 0;
+  default:
+    if (delta) {
+      s->dataPtr = svb_decode_d1(s->out, s->keyPtr, s->dataPtr, count, s->prev);
+      s->prev = s->out[count - 1];
+    } else {
+      s->dataPtr = svb_decode(s->out, s->keyPtr, s->dataPtr, count);
+    }
+    s->keyPtr += count / 4; // all chunks but the last hold multiples of 4
+    s->out += count;
+    s->remaining -= count;
+    s->step = SVB_BATCH_KEYS;
+    return s->remaining == 0 ? (size_t)(s->dataPtr - s->in) : 0;
+  }
+}
+
+static size_t _decode_batch(const streamvbyte_batch_t *lists, size_t count,
+                            int delta) {
+  svb_batch_state_t states[STREAMVBYTE_BATCH_INFLIGHT];
+  size_t inflight = 0, next = 0, bytes = 0;
+  // empty streams read nothing
+  while (next < count && inflight < STREAMVBYTE_BATCH_INFLIGHT) {
+    if (lists[next].length > 0)
+      _start(&states[inflight++], &lists[next]);
+    next++;
+  }
+  while (inflight > 0) {
+    for (size_t i = 0; i < inflight;) {
+      size_t read = _step(&states[i], delta);
+      if (read == 0 && states[i].remaining > 0) {
+        i++;
+        continue;
+      }
+      bytes += read;
+      // replace the finished stream by the next one
+      while (next < count && lists[next].length == 0)
+        next++;
+      if (next < count) {
+        _start(&states[i], &lists[next++]);
+        i++;
+      } else {
+        states[i] = states[--inflight];
+      }
+    }
+  }
+  return bytes;
+}
+
+size_t streamvbyte_decode_batch(const streamvbyte_batch_t *lists, size_t count) {
+  return _decode_batch(lists, count, 0);
+}
+
+size_t streamvbyte_delta_decode_batch(const streamvbyte_batch_t *lists, size_t count) {
+  return _decode_batch(lists, count, 1);
+}
@@ -0,0 +1,73 @@
+#include "streamvbyteblockmax.h"
+#include "streamvbyte_internal.h"
+
+size_t streamvbyte_blockmax_encode(const uint32_t *docids, const uint32_t *values,
+                                   uint32_t length, uint32_t blocksize,
+                                   uint8_t *out, streamvbyte_block_t *blocks) {
+  uint8_t *p = out;
+  uint32_t prev = 0;
+  if (blocksize == 0)
+    return 0;
+  // row is a size_t so that row + blocksize cannot wrap around
+  for (size_t row = 0, b = 0; row < length; row += blocksize, b++) {
+    uint32_t count = (uint32_t)(length - row);
+    if (count > blocksize)
+      count = blocksize;
+    uint32_t maxvalue = 0;
+    for (uint32_t i = 0; i < count; i++)
+      if (values[row + i] > maxvalue)
+        maxvalue = values[row + i];
+
+    blocks[b].lastdocid = docids[row + count - 1];
+    blocks[b].maxvalue = maxvalue;
+    blocks[b].offset = (uint32_t)(p - out);
+    // each block starts from the last document identifier of the previous
+    // one so that it can be decoded alone
+    size_t keyLen = count / 4 + (count % 4 != 0); // 2-bits rounded to full byte
+    p = svb_encode_d1(docids + row, p, p + keyLen, count, prev);
+    blocks[b].valueoffset = (uint32_t)(p - out);
+    p = svb_encode(values + row, p, p + keyLen, count);
+    prev = blocks[b].lastdocid;
+  }
+  return p - out;
+}
+
+size_t streamvbyte_blockmax_seek(const streamvbyte_block_t *blocks, size_t nblocks,
+                                 size_t block, uint32_t target, uint32_t threshold) {
+  // the last document identifiers are sorted: find the first block that can
+  // hold target by binary search
+  size_t lo = block, hi = nblocks;
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    if (blocks[mid].lastdocid < target)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  // then skip the blocks whose values are all too small
+  while (lo < nblocks && blocks[lo].maxvalue <= threshold)
+    lo++;
+  return lo;
+}
+
+size_t streamvbyte_blockmax_decode_block(const uint8_t *in,
+                                         const streamvbyte_block_t *blocks,
+                                         size_t block, uint32_t length,
+                                         uint32_t blocksize, uint32_t *docids,
+                                         uint32_t *values) {
+  if (blocksize == 0)
+    return 0;
+  size_t row = block * blocksize;
+  size_t count = length - row;
+  if (count > blocksize)
+    count = blocksize;
+  uint32_t prev = block > 0 ? blocks[block - 1].lastdocid : 0;
+  size_t keyLen = count / 4 + (count % 4 != 0); // 2-bits per key (rounded up)
+  const uint8_t *keyPtr = in + blocks[block].offset;
+  svb_decode_d1(docids, keyPtr, keyPtr + keyLen, count, prev);
+  if (values != NULL) {
+    keyPtr = in + blocks[block].valueoffset;
+    svb_decode(values, keyPtr, keyPtr + keyLen, count);
+  }
+  return count;
+}
@@ -0,0 +1,233 @@
+#include "streamvbytecache.h"
+
+#include <string.h> // for memcpy
+
+// The state word of a slot holds a tag in its low 2 bits and, for retired
+// slots, the epoch of their retirement in the others (0 while it is being
+// recorded).
+#define SVB_CACHE_EMPTY 0   // never used
+#define SVB_CACHE_BUSY 1    // being filled by an inserting thread
+#define SVB_CACHE_READY 2   // visible to lookups
+#define SVB_CACHE_RETIRED 3 // evicted, reusable once no thread may read it
+
+#define SVB_CACHE_LINE 64
+
+typedef struct {
+  uint64_t state;
+  uint64_t key;      // written before the slot becomes ready
+  uint32_t count;    // written before the slot becomes ready
+  uint32_t referenced; // CLOCK reference bit
+} svb_cache_slot_t;
+
+// epoch announced by a thread, 0 outside of critical sections; one per cache
+// line so that threads do not contend
+typedef struct {
+  uint64_t epoch;
+  uint8_t padding[SVB_CACHE_LINE - sizeof(uint64_t)];
+} svb_cache_thread_t;
+
+struct streamvbyte_cache_s {
+  uint64_t epoch; // global epoch, starts at 1
+  uint8_t padding[SVB_CACHE_LINE - sizeof(uint64_t)];
+  uint32_t registered;
+  uint32_t maxthreads;
+  uint32_t blockvalues;
+  size_t nsets;
+  svb_cache_thread_t *threads;
+  uint32_t *hands; // CLOCK hand of each set
+  svb_cache_slot_t *slots;
+  uint32_t *values; // blockvalues integers per slot
+};
+
+static inline uint8_t *_align(uint8_t *p) {
+  return p + ((SVB_CACHE_LINE - (uintptr_t)p % SVB_CACHE_LINE) % SVB_CACHE_LINE);
+}
+
+streamvbyte_cache_t *streamvbyte_cache_init(void *mem, size_t bytes,
+                                            uint32_t blockvalues,
+                                            uint32_t maxthreads) {
+  uint8_t *begin = (uint8_t *)mem;
+  uint8_t *p = _align(begin);
+  streamvbyte_cache_t *cache = (streamvbyte_cache_t *)p;
+  p = _align(p + sizeof(streamvbyte_cache_t));
+  svb_cache_thread_t *threads = (svb_cache_thread_t *)p;
+  p += (size_t)maxthreads * sizeof(svb_cache_thread_t);
+  size_t fixed = (size_t)(p - begin);
+  size_t perset = STREAMVBYTE_CACHE_WAYS *
+                      (sizeof(svb_cache_slot_t) + (size_t)blockvalues * sizeof(uint32_t)) +
+                  sizeof(uint32_t);
+  if (bytes < fixed || (bytes - fixed) / perset == 0)
+    return NULL;
+  size_t nsets = (bytes - fixed) / perset;
+  size_t nslots = nsets * STREAMVBYTE_CACHE_WAYS;
+
+  memset(cache, 0, sizeof(streamvbyte_cache_t));
+  cache->epoch = 1;
+  cache->maxthreads = maxthreads;
+  cache->blockvalues = blockvalues;
+  cache->nsets = nsets;
+  cache->threads = threads;
+  cache->values = (uint32_t *)p;
+  p += nslots * blockvalues * sizeof(uint32_t);
+  cache->slots = (svb_cache_slot_t *)p;
+  p += nslots * sizeof(svb_cache_slot_t);
+  cache->hands = (uint32_t *)p;
+  memset(threads, 0, (size_t)maxthreads * sizeof(svb_cache_thread_t));
+  memset(cache->slots, 0, nslots * sizeof(svb_cache_slot_t));
+  memset(cache->hands, 0, nsets * sizeof(uint32_t));
+  __atomic_thread_fence(__ATOMIC_RELEASE);
+  return cache;
+}
+
+size_t streamvbyte_cache_capacity(const streamvbyte_cache_t *cache) {
+  return cache->nsets * STREAMVBYTE_CACHE_WAYS;
+}
+
+int streamvbyte_cache_register(streamvbyte_cache_t *cache) {
+  uint32_t tid = __atomic_fetch_add(&cache->registered, 1, __ATOMIC_RELAXED);
+  return tid < cache->maxthreads ? (int)tid : -1;
+}
+
+void streamvbyte_cache_enter(streamvbyte_cache_t *cache, int tid) {
+  // sequentially consistent, so that the slots are read after the
+  // announcement is visible to the threads retiring them
+  __atomic_store_n(&cache->threads[tid].epoch,
+                   __atomic_load_n(&cache->epoch, __ATOMIC_SEQ_CST),
+                   __ATOMIC_SEQ_CST);
+}
+
+void streamvbyte_cache_leave(streamvbyte_cache_t *cache, int tid) {
+  __atomic_store_n(&cache->threads[tid].epoch, 0, __ATOMIC_RELEASE);
+}
+
+static inline uint64_t _key(uint32_t stream, uint32_t block) {
+  return ((uint64_t)stream << 32) | block;
+}
+
+static inline size_t _set(const streamvbyte_cache_t *cache, uint64_t key) {
+  return (size_t)((key * UINT64_C(0x9E3779B97F4A7C15)) >> 32) % cache->nsets;
+}
+
+const uint32_t *streamvbyte_cache_lookup(streamvbyte_cache_t *cache, int tid,
+                                         uint32_t stream, uint32_t block,
+                                         uint32_t *count) {
+  (void)tid;
+  uint64_t key = _key(stream, block);
+  size_t first = _set(cache, key) * STREAMVBYTE_CACHE_WAYS;
+  for (size_t s = first; s < first + STREAMVBYTE_CACHE_WAYS; s++) {
+    svb_cache_slot_t *slot = &cache->slots[s];
+    uint64_t state = __atomic_load_n(&slot->state, __ATOMIC_SEQ_CST);
+    if ((state & 3) != SVB_CACHE_READY ||
+        __atomic_load_n(&slot->key, __ATOMIC_RELAXED) != key)
+      continue;
+    // only write the reference bit when it changes, to keep the line shared
+    if (!__atomic_load_n(&slot->referenced, __ATOMIC_RELAXED))
+      __atomic_store_n(&slot->referenced, 1, __ATOMIC_RELAXED);
+    *count = __atomic_load_n(&slot->count, __ATOMIC_RELAXED);
+    return cache->values + s * cache->blockvalues;
+  }
+  return NULL;
+}
+
+// whether no thread may still read a slot retired at epoch retired
+static int _reclaimable(const streamvbyte_cache_t *cache, uint64_t retired) {
+  uint32_t n = __atomic_load_n(&cache->registered, __ATOMIC_RELAXED);
+  if (n > cache->maxthreads)
+    n = cache->maxthreads;
+  for (uint32_t t = 0; t < n; t++) {
+    uint64_t announced = __atomic_load_n(&cache->threads[t].epoch, __ATOMIC_SEQ_CST);
+    if (announced != 0 && announced < retired)
+      return 0;
+  }
+  return 1;
+}
+
+// Try to take a slot for filling. Empty slots and reclaimable retired slots
+// are taken. Ready slots are given a second chance, then retired unless
+// *retired is set: the inserting thread is within a critical section, so
+// they only become reclaimable for later insertions.
+static int _claim(streamvbyte_cache_t *cache, svb_cache_slot_t *slot,
+                  int *retired) {
+  uint64_t state = __atomic_load_n(&slot->state, __ATOMIC_ACQUIRE);
+  switch (state & 3) {
+  case SVB_CACHE_EMPTY:
+    break;
+  case SVB_CACHE_READY:
+    if (__atomic_load_n(&slot->referenced, __ATOMIC_RELAXED)) {
+      __atomic_store_n(&slot->referenced, 0, __ATOMIC_RELAXED);
+      return 0;
+    }
+    if (*retired ||
+        !__atomic_compare_exchange_n(&slot->state, &state, SVB_CACHE_RETIRED,
+                                     0, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED))
+      return 0;
+    *retired = 1;
+    // Lookups announcing this epoch or a later one see the slot retired:
+    // the epoch must be taken after the slot left the ready state.
+    state = (__atomic_add_fetch(&cache->epoch, 1, __ATOMIC_SEQ_CST) << 2) |
+            SVB_CACHE_RETIRED;
+    __atomic_store_n(&slot->state, state, __ATOMIC_RELEASE);
+    return 0;
+  case SVB_CACHE_RETIRED:
+    if ((state >> 2) == 0 || !_reclaimable(cache, state >> 2))
+      return 0;
+    break;
+  default: // busy
+    return 0;
+  }
+  return __atomic_compare_exchange_n(&slot->state, &state, SVB_CACHE_BUSY, 0,
+                                     __ATOMIC_ACQUIRE, __ATOMIC_RELAXED);
+}
+
+const uint32_t *streamvbyte_cache_insert(streamvbyte_cache_t *cache, int tid,
+                                         uint32_t stream, uint32_t block,
+                                         const uint32_t *values, uint32_t count) {
+  (void)tid;
+  if (count > cache->blockvalues) // would overflow the slot
+    return NULL;
+  uint64_t key = _key(stream, block);
+  size_t set = _set(cache, key);
+  // keep a single retired slot per set: while readers hold it back, the
+  // other blocks of the set stay available to lookups
+  int retired = 0;
+  for (size_t s = set * STREAMVBYTE_CACHE_WAYS; s < (set + 1) * STREAMVBYTE_CACHE_WAYS; s++)
+    retired |= (__atomic_load_n(&cache->slots[s].state, __ATOMIC_RELAXED) & 3) ==
+               SVB_CACHE_RETIRED;
+  // at most two turns of the hand: the first one may only clear the
+  // reference bits
+  for (int step = 0; step < 2 * STREAMVBYTE_CACHE_WAYS; step++) {
+    uint32_t way = __atomic_fetch_add(&cache->hands[set], 1, __ATOMIC_RELAXED) %
+                   STREAMVBYTE_CACHE_WAYS;
+    size_t s = set * STREAMVBYTE_CACHE_WAYS + way;
+    svb_cache_slot_t *slot = &cache->slots[s];
+    if (!_claim(cache, slot, &retired))
+      continue;
+    uint32_t *cached = cache->values + s * cache->blockvalues;
+    memcpy(cached, values, count * sizeof(uint32_t));
+    __atomic_store_n(&slot->key, key, __ATOMIC_RELAXED);
+    __atomic_store_n(&slot->count, count, __ATOMIC_RELAXED);
+    __atomic_store_n(&slot->referenced, 1, __ATOMIC_RELAXED);
+    __atomic_store_n(&slot->state, SVB_CACHE_READY, __ATOMIC_RELEASE);
+    return cached;
+  }
+  return NULL;
+}
+
+const uint32_t *streamvbyte_cache_blockmax(streamvbyte_cache_t *cache, int tid,
+                                           uint32_t stream, const uint8_t *in,
+                                           const streamvbyte_block_t *blocks,
+                                           size_t block, uint32_t length,
+                                           uint32_t blocksize, uint32_t *scratch) {
+  uint32_t count;
+  const uint32_t *cached =
+      streamvbyte_cache_lookup(cache, tid, stream, (uint32_t)block, &count);
+  if (cached != NULL)
+    return cached;
+  size_t n = streamvbyte_blockmax_decode_block(in, blocks, block, length,
+                                               blocksize, scratch, scratch + blocksize);
+  if (n < blocksize) // values right after the document identifiers
+    memmove(scratch + n, scratch + blocksize, n * sizeof(uint32_t));
+  cached = streamvbyte_cache_insert(cache, tid, stream, (uint32_t)block,
+                                    scratch, (uint32_t)(2 * n));
+  return cached != NULL ? cached : scratch;
+}
@@ -0,0 +1,121 @@
+#include "streamvbytecolumns.h"
+
+#include "streamvbyte_internal.h"
+#include <string.h> // for memcpy
+
+// Rows are processed in chunks of this many values: the chunk of every column
+// is encoded (or decoded) before moving to the next rows, so that the rows
+// are still in cache when the next column is visited. Must be a multiple of
+// 32 so that each chunk fills whole key bytes and whole vectorized blocks.
+#define SVB_COLUMNS_CHUNK 256
+
+size_t streamvbyte_encode_columns(const uint32_t *const *in, size_t ncolumns,
+                                  uint32_t length, uint8_t *const *out,
+                                  size_t *sizes) {
+  size_t keyLen = streamvbyte_columns_keybytes(length); // 2-bits rounded to full byte
+  for (size_t i = 0; i < ncolumns; i++)
+    sizes[i] = keyLen; // variable byte data after all keys
+
+  // row is a size_t so that row + SVB_COLUMNS_CHUNK cannot wrap around
+  for (size_t row = 0; row < length; row += SVB_COLUMNS_CHUNK) {
+    uint32_t count = (uint32_t)(length - row);
+    if (count > SVB_COLUMNS_CHUNK)
+      count = SVB_COLUMNS_CHUNK;
+    for (size_t i = 0; i < ncolumns; i++) {
+      uint8_t *keyPtr = out[i] + row / 4;
+      uint8_t *dataPtr = out[i] + sizes[i];
+      sizes[i] = svb_encode(in[i] + row, keyPtr, dataPtr, count) - out[i];
+    }
+  }
+
+  size_t total = 0;
+  for (size_t i = 0; i < ncolumns; i++)
+    total += sizes[i];
+  return total;
+}
+
+size_t streamvbyte_decode_columns(const uint8_t *const *in, uint32_t *const *out,
+                                  size_t ncolumns, uint32_t length,
+                                  size_t *sizes) {
+  size_t keyLen = streamvbyte_columns_keybytes(length); // 2-bits per key (rounded up)
+  for (size_t i = 0; i < ncolumns; i++)
+    sizes[i] = keyLen; // data starts at end of keys
+
+  // row is a size_t so that row + SVB_COLUMNS_CHUNK cannot wrap around
+  for (size_t row = 0; row < length; row += SVB_COLUMNS_CHUNK) {
+    uint32_t count = (uint32_t)(length - row);
+    if (count > SVB_COLUMNS_CHUNK)
+      count = SVB_COLUMNS_CHUNK;
+    for (size_t i = 0; i < ncolumns; i++) {
+      const uint8_t *keyPtr = in[i] + row / 4;
+      const uint8_t *dataPtr = in[i] + sizes[i];
+      sizes[i] = svb_decode(out[i] + row, keyPtr, dataPtr, count) - in[i];
+    }
+  }
+
+  size_t total = 0;
+  for (size_t i = 0; i < ncolumns; i++)
+    total += sizes[i];
+  return total;
+}
+
+size_t streamvbyte_encode_rows(const uint8_t *rows, size_t stride,
+                               const size_t *offsets, size_t ncolumns,
+                               uint32_t length, uint8_t *const *out,
+                               size_t *sizes) {
+  uint32_t column[SVB_COLUMNS_CHUNK];
+  size_t keyLen = streamvbyte_columns_keybytes(length); // 2-bits rounded to full byte
+  for (size_t i = 0; i < ncolumns; i++)
+    sizes[i] = keyLen; // variable byte data after all keys
+
+  // row is a size_t so that row + SVB_COLUMNS_CHUNK cannot wrap around
+  for (size_t row = 0; row < length; row += SVB_COLUMNS_CHUNK) {
+    uint32_t count = (uint32_t)(length - row);
+    if (count > SVB_COLUMNS_CHUNK)
+      count = SVB_COLUMNS_CHUNK;
+    const uint8_t *chunk = rows + row * stride;
+    for (size_t i = 0; i < ncolumns; i++) {
+      const uint8_t *field = chunk + offsets[i];
+      for (uint32_t r = 0; r < count; r++) // gather the column
+        memcpy(&column[r], field + r * stride, sizeof(uint32_t));
+      uint8_t *keyPtr = out[i] + row / 4;
+      uint8_t *dataPtr = out[i] + sizes[i];
+      sizes[i] = svb_encode(column, keyPtr, dataPtr, count) - out[i];
+    }
+  }
+
+  size_t total = 0;
+  for (size_t i = 0; i < ncolumns; i++)
+    total += sizes[i];
+  return total;
+}
+
+size_t streamvbyte_decode_rows(const uint8_t *const *in, uint8_t *rows,
+                               size_t stride, const size_t *offsets,
+                               size_t ncolumns, uint32_t length, size_t *sizes) {
+  uint32_t column[SVB_COLUMNS_CHUNK];
+  size_t keyLen = streamvbyte_columns_keybytes(length); // 2-bits per key (rounded up)
+  for (size_t i = 0; i < ncolumns; i++)
+    sizes[i] = keyLen; // data starts at end of keys
+
+  // row is a size_t so that row + SVB_COLUMNS_CHUNK cannot wrap around
+  for (size_t row = 0; row < length; row += SVB_COLUMNS_CHUNK) {
+    uint32_t count = (uint32_t)(length - row);
+    if (count > SVB_COLUMNS_CHUNK)
+      count = SVB_COLUMNS_CHUNK;
+    uint8_t *chunk = rows + row * stride;
+    for (size_t i = 0; i < ncolumns; i++) {
+      const uint8_t *keyPtr = in[i] + row / 4;
+      const uint8_t *dataPtr = in[i] + sizes[i];
+      sizes[i] = svb_decode(column, keyPtr, dataPtr, count) - in[i];
+      uint8_t *field = chunk + offsets[i];
+      for (uint32_t r = 0; r < count; r++) // scatter the column
+        memcpy(field + r * stride, &column[r], sizeof(uint32_t));
+    }
+  }
+
+  size_t total = 0;
+  for (size_t i = 0; i < ncolumns; i++)
+    total += sizes[i];
+  return total;
+}
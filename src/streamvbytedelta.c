@@ -22,12 +22,27 @@
 
 #ifdef __AVX__
 
+#ifdef __AVX2__
+#define SVB_ENCODING_SHUFFLE_TABLE // for streamvbyte_encode8
+#endif
 #include "streamvbyte_shuffle_tables.h"
+#include "streamvbyte_delta_kernels.h"
 
 #endif
 
+#include "streamvbyte_internal.h"
+#include "streamvbyte_probes.h"
 #include <string.h> // for memcpy
 
+// the kernels used by the encoder and the decoder, for the probes
+#ifdef __AVX2__
+#define SVB_DELTA_KERNEL_PATH SVB_PATH_AVX2
+#elif defined(__AVX__)
+#define SVB_DELTA_KERNEL_PATH SVB_PATH_AVX
+#else
+#define SVB_DELTA_KERNEL_PATH SVB_PATH_SCALAR
+#endif
+
 static uint8_t _encode_data(uint32_t val, uint8_t *__restrict__ *dataPtrPtr) {
   uint8_t *dataPtr = *dataPtrPtr;
   uint8_t code;
@@ -56,13 +71,13 @@ static uint8_t _encode_data(uint32_t val, uint8_t *__restrict__ *dataPtrPtr) {
 static uint8_t *svb_encode_scalar_d1_init(const uint32_t *in,
                                           uint8_t *__restrict__ keyPtr,
                                           uint8_t *__restrict__ dataPtr,
-                                          uint32_t count, uint32_t prev) {
+                                          size_t count, uint32_t prev) {
   if (count == 0)
     return dataPtr; // exit immediately if no data
 
   uint8_t shift = 0; // cycles 0, 2, 4, 6, 0, 2, 4, 6, ...
   uint8_t key = 0;
-  for (uint32_t c = 0; c < count; c++) {
+  for (size_t c = 0; c < count; c++) {
     if (shift == 8) {
       shift = 0;
       *keyPtr++ = key;
@@ -81,25 +96,98 @@ static uint8_t *svb_encode_scalar_d1_init(const uint32_t *in,
 
 #ifdef __AVX__
 
-// from streamvbyte.c
-size_t streamvbyte_encode_quad(__m128i in, uint8_t *outData, uint8_t *outCode);
-
 static __m128i Delta(__m128i curr, __m128i prev) {
   return _mm_sub_epi32(curr, _mm_alignr_epi8(curr, prev, 12));
 }
 
+#ifdef __AVX2__
+
+// streamvbyte_encode4 on 8 integers: each 128-bit lane holds a quad. Writes
+// the two control bytes to outCode, stores 16 bytes at outData and at the end
+// of the data of the first quad (up to 12 bytes past the data of the second
+// quad), and returns the number of data bytes.
+static inline size_t streamvbyte_encode8(__m256i in, uint8_t *outData,
+                                         uint8_t *outCode) {
+  const __m256i Ones = _mm256_set1_epi32(0x01010101);
+  const __m256i GatherBits = _mm256_set1_epi32(0x02040001);
+  const __m256i CodeTable =
+      _mm256_set_epi32(0, 0, 0x03030303, 0x02020100, 0, 0, 0x03030303, 0x02020100);
+  const __m256i GatherBytes =
+      _mm256_set_epi32(0, 0, 0x0D090501, 0x0D090501, 0, 0, 0x0D090501, 0x0D090501);
+  const __m256i Aggregators =
+      _mm256_set_epi32(0, 0, 0x01010101, 0x10400104, 0, 0, 0x01010101, 0x10400104);
+  const __m256i GatherLanes = _mm256_set_epi32(0, 0, 0, 0, 5, 1, 4, 0);
+
+  __m256i m0, m1;
+  m0 = _mm256_min_epu8(in, Ones); // set byte to 1 if it is not zero
+  m0 = _mm256_madd_epi16(m0, GatherBits); // gather bits 8,16,24 to bits 8,9,10
+  m1 = _mm256_shuffle_epi8(CodeTable, m0); // translate to a 2-bit encoded symbol
+  m1 = _mm256_shuffle_epi8(m1, GatherBytes); // gather bytes holding symbols; 2 copies
+  m1 = _mm256_madd_epi16(m1, Aggregators); // sum dword_1, pack dword_0
+  // [code0 length0 code1 length1] in the low lane
+  __m128i m2 = _mm256_castsi256_si128(_mm256_permutevar8x32_epi32(m1, GatherLanes));
+
+  // extract data lengths and decode keys
+  uint64_t codes = (uint64_t)_mm_cvtsi128_si64(m2);
+  uint64_t lengths = (uint64_t)_mm_extract_epi64(m2, 1);
+  size_t code0 = (codes >> 8) & 0xFF, code1 = (codes >> 40) & 0xFF;
+  size_t length0 = 4 + ((lengths >> 8) & 0xFF);
+  size_t length1 = 4 + ((lengths >> 40) & 0xFF);
+
+  __m256i Shuf = _mm256_inserti128_si256(
+      _mm256_castsi128_si256(
+          _mm_loadu_si128((__m128i *)encodingShuffleTable[code0])),
+      _mm_loadu_si128((__m128i *)encodingShuffleTable[code1]), 1);
+  __m256i out = _mm256_shuffle_epi8(in, Shuf);
+
+  _mm_storeu_si128((__m128i *)outData, _mm256_castsi256_si128(out));
+  _mm_storeu_si128((__m128i *)(outData + length0),
+                   _mm256_extracti128_si256(out, 1));
+  outCode[0] = (uint8_t)code0;
+  outCode[1] = (uint8_t)code1;
+  return length0 + length1;
+}
+
+#endif
+
 static uint8_t *svb_encode_vector_d1_init(const uint32_t *in,
                                           uint8_t *__restrict__ keyPtr,
                                           uint8_t *__restrict__ dataPtr,
-                                          uint32_t count, uint32_t prev) {
+                                          size_t count, uint32_t prev) {
 
   uint8_t *outData = dataPtr;
   uint8_t *outKey = keyPtr;
 
-  uint32_t count4 = count / 4;
+#ifdef __AVX2__
+  // same rule as below, for blocks of 8 integers
+  size_t count8 = count >= 20 ? (count - 12) / 8 : 0;
+  // [P P P P P P P P], then [in[7] in[0] .. in[6]] of the previous block:
+  // lane 0 holds the value preceding the current block
+  __m256i Shifted = _mm256_set1_epi32(prev);
+  const __m256i Rotate = _mm256_set_epi32(6, 5, 4, 3, 2, 1, 0, 7);
+  for (size_t c = 0; c < count8; c++) {
+    __m256i vin = _mm256_loadu_si256((__m256i *)(in + 8 * c));
+    __m256i Previous = Shifted;
+    Shifted = _mm256_permutevar8x32_epi32(vin, Rotate);
+    // [p in[0] .. in[6]]
+    __m256i deltain = _mm256_sub_epi32(
+        vin, _mm256_blend_epi32(Shifted, Previous, 0x01));
+    outData += streamvbyte_encode8(deltain, outData, outKey);
+    outKey += 2;
+  }
+  if (count8 > 0)
+    prev = in[8 * count8 - 1];
+  in += 8 * count8;
+  count -= 8 * count8;
+#endif
+
+  // streamvbyte_encode4 stores 16 bytes, up to 12 bytes past the data of the
+  // quad: keep at least 12 integers for the scalar code so that nothing is
+  // written past the end of the compressed data (see svb_encode).
+  size_t count4 = count >= 16 ? (count - 12) / 4 : 0;
   __m128i Prev = _mm_set1_epi32(prev);
 
-  for (uint32_t c = 0; c < count4; c++) {
+  for (size_t c = 0; c < count4; c++) {
     __m128i vin = _mm_loadu_si128((__m128i *)(in + 4 * c));
     __m128i deltain = Delta(vin, Prev);
     Prev = vin;
@@ -115,73 +203,51 @@ static uint8_t *svb_encode_vector_d1_init(const uint32_t *in,
 
 #endif
 
-size_t streamvbyte_delta_encode(uint32_t *in, uint32_t count, uint8_t *out,
-                                uint32_t prev) {
-  uint8_t *keyPtr = out;             // keys come immediately after 32-bit count
-  uint32_t keyLen = (count + 3) / 4; // 2-bits rounded to full byte
-  uint8_t *dataPtr = keyPtr + keyLen; // variable byte data after all keys
+// Encode count values read from in as differences from prev and from each
+// other, writing the keys to keyPtr and the data bytes to dataPtr. Returns a
+// pointer to the first unused data byte.
+// Also used by the other translation units to encode slices of a stream.
+uint8_t *svb_encode_d1(const uint32_t *in, uint8_t *__restrict__ keyPtr,
+                       uint8_t *__restrict__ dataPtr, size_t count,
+                       uint32_t prev) {
 #ifdef __AVX__
-  return svb_encode_vector_d1_init(in, keyPtr, dataPtr, count, prev) - out;
+  return svb_encode_vector_d1_init(in, keyPtr, dataPtr, count, prev);
 #else
-  return svb_encode_scalar_d1_init(in, keyPtr, dataPtr, count, prev) - out;
+  return svb_encode_scalar_d1_init(in, keyPtr, dataPtr, count, prev);
 #endif
 }
 
-#ifdef __AVX__
-static inline __m128i _decode_avx(uint32_t key,
-                                  const uint8_t *__restrict__ *dataPtrPtr) {
-  uint8_t len = lengthTable[key];
-  __m128i Data = _mm_loadu_si128((__m128i *)*dataPtrPtr);
-  __m128i Shuf = *(__m128i *)&shuffleTable[key];
-
-  Data = _mm_shuffle_epi8(Data, Shuf);
-  *dataPtrPtr += len;
-
-  return Data;
+size_t streamvbyte_delta_encode64(const uint32_t *in, size_t count,
+                                  uint8_t *out, uint32_t prev) {
+  SVB_PROBE1(delta_encode_entry, count);
+  uint8_t *keyPtr = out;             // keys come immediately after 32-bit count
+  size_t keyLen = count / 4 + (count % 4 != 0); // 2-bits rounded to full byte
+  uint8_t *dataPtr = keyPtr + keyLen; // variable byte data after all keys
+  size_t bytes = svb_encode_d1(in, keyPtr, dataPtr, count, prev) - out;
+  SVB_PROBE3(delta_encode_return, count, bytes, SVB_DELTA_KERNEL_PATH);
+  return bytes;
 }
-#define BroadcastLastXMM 0xFF // bits 0-7 all set to choose highest element
 
-static inline void _write_avx(uint32_t *out, __m128i Vec) {
-  _mm_storeu_si128((__m128i *)out, Vec);
+size_t streamvbyte_delta_encode(uint32_t *in, uint32_t count, uint8_t *out,
+                                uint32_t prev) {
+  return streamvbyte_delta_encode64(in, count, out, prev);
 }
 
-static __m128i _write_avx_d1(uint32_t *out, __m128i Vec, __m128i Prev) {
-  __m128i Add = _mm_slli_si128(Vec, 4); // Cycle 1: [- A B C] (already done)
-  Prev = _mm_shuffle_epi32(Prev, BroadcastLastXMM); // Cycle 2: [P P P P]
-  Vec = _mm_add_epi32(Vec, Add);                    // Cycle 2: [A AB BC CD]
-  Add = _mm_slli_si128(Vec, 8);                     // Cycle 3: [- - A AB]
-  Vec = _mm_add_epi32(Vec, Prev);                   // Cycle 3: [PA PAB PBC PCD]
-  Vec = _mm_add_epi32(Vec, Add); // Cycle 4: [PA PAB PABC PABCD]
-
-  _write_avx(out, Vec);
-  return Vec;
+size_t streamvbyte_delta_compressedbytes64(const uint32_t *in, size_t length,
+                                           uint32_t prev) {
+  size_t bytes = length / 4 + (length % 4 != 0); // number of control bytes
+  for (size_t c = 0; c < length; c++) {
+    uint32_t val = in[c] - prev;
+    prev = in[c];
+    bytes += 1 + (val > 0xFF) + (val > 0xFFFF) + (val > 0xFFFFFF);
+  }
+  return bytes;
 }
 
-#ifndef _MSC_VER
-static __m128i High16To32 = {0xFFFF0B0AFFFF0908, 0xFFFF0F0EFFFF0D0C};
-#else
-static __m128i High16To32 = {8,  9,  -1, -1, 10, 11, -1, -1,
-                             12, 13, -1, -1, 14, 15, -1, -1};
-#endif
-
-static inline __m128i _write_16bit_avx_d1(uint32_t *out, __m128i Vec,
-                                          __m128i Prev) {
-  // vec == [A B C D E F G H] (16 bit values)
-  __m128i Add = _mm_slli_si128(Vec, 2);             // [- A B C D E F G]
-  Prev = _mm_shuffle_epi32(Prev, BroadcastLastXMM); // [P P P P] (32-bit)
-  Vec = _mm_add_epi32(Vec, Add);                    // [A AB BC CD DE FG GH]
-  Add = _mm_slli_si128(Vec, 4);                     // [- - A AB BC CD DE EF]
-  Vec = _mm_add_epi32(Vec, Add);        // [A AB ABC ABCD BCDE CDEF DEFG EFGH]
-  __m128i V1 = _mm_cvtepu16_epi32(Vec); // [A AB ABC ABCD] (32-bit)
-  V1 = _mm_add_epi32(V1, Prev);         // [PA PAB PABC PABCD] (32-bit)
-  __m128i V2 =
-      _mm_shuffle_epi8(Vec, High16To32); // [BCDE CDEF DEFG EFGH] (32-bit)
-  V2 = _mm_add_epi32(V1, V2); // [PABCDE PABCDEF PABCDEFG PABCDEFGH] (32-bit)
-  _write_avx(out, V1);
-  _write_avx(out + 4, V2);
-  return V2;
+size_t streamvbyte_delta_compressedbytes(const uint32_t *in, uint32_t length,
+                                         uint32_t prev) {
+  return streamvbyte_delta_compressedbytes64(in, length, prev);
 }
-#endif
 
 static inline uint32_t _decode_data(const uint8_t **dataPtrPtr, uint8_t code) {
   const uint8_t *dataPtr = *dataPtrPtr;
@@ -209,7 +275,7 @@ static inline uint32_t _decode_data(const uint8_t **dataPtrPtr, uint8_t code) {
 
 static const uint8_t *svb_decode_scalar_d1_init(uint32_t *outPtr,
                                          const uint8_t *keyPtr,
-                                         const uint8_t *dataPtr, uint32_t count,
+                                         const uint8_t *dataPtr, size_t count,
                                          uint32_t prev) {
   if (count == 0)
     return dataPtr; // no reads or writes if no data
@@ -217,7 +283,7 @@ static const uint8_t *svb_decode_scalar_d1_init(uint32_t *outPtr,
   uint8_t shift = 0;
   uint32_t key = *keyPtr++;
 
-  for (uint32_t c = 0; c < count; c++) {
+  for (size_t c = 0; c < count; c++) {
     if (shift == 8) {
       shift = 0;
       key = *keyPtr++;
@@ -343,14 +409,196 @@ const uint8_t *svb_decode_avx_d1_init(uint32_t *out,
 
 #endif
 
+#ifdef __AVX2__
+// Same as svb_decode_avx_d1_init, with the prefix sums computed over 8 lanes:
+// the previous value is carried once per 8 integers (16 on the 8-bit path)
+// instead of once per 4.
+const uint8_t *svb_decode_avx2_d1_init(uint32_t *out,
+                                       const uint8_t *__restrict__ keyPtr,
+                                       const uint8_t *__restrict__ dataPtr,
+                                       uint64_t count, uint32_t prev) {
+  uint64_t keywords = count / 32; // number of 64-bit words of keys
+  __m256i Prev = _mm256_set1_epi32(prev);
+  for (uint64_t i = 0; i < keywords; i++) {
+    uint64_t keys;
+    memcpy(&keys, keyPtr + 8 * i, sizeof(keys));
+    // faster 16-bit delta since we only have 8-bit values
+    if (!keys) { // 32 1-byte ints in a row
+      __m256i Data = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *)dataPtr));
+      Prev = _write_16bit_avx2_d1(out, Data, Prev);
+      Data = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *)(dataPtr + 16)));
+      Prev = _write_16bit_avx2_d1(out + 16, Data, Prev);
+      out += 32;
+      dataPtr += 32;
+      continue;
+    }
+
+    Prev = _write_avx2_d1(out, _decode_avx2(keys, &dataPtr), Prev);
+    Prev = _write_avx2_d1(out + 8, _decode_avx2(keys >> 16, &dataPtr), Prev);
+    Prev = _write_avx2_d1(out + 16, _decode_avx2(keys >> 32, &dataPtr), Prev);
+    Prev = _write_avx2_d1(out + 24, _decode_avx2(keys >> 48, &dataPtr), Prev);
+    out += 32;
+  }
+  if (keywords > 0)
+    prev = out[-1];
+  return svb_decode_scalar_d1_init(out, keyPtr + 8 * keywords, dataPtr,
+                                   count & 31, prev);
+}
+#endif
+
+static inline int _is_live(const uint64_t *live, uint32_t docid) {
+  return (live[docid / 64] >> (docid % 64)) & 1;
+}
+
+// Same as svb_decode_scalar_d1_init, except that out only advances by the live
+// values, whose number is stored to *written.
+static const uint8_t *svb_decode_scalar_d1_live(uint32_t *out,
+                                                const uint8_t *keyPtr,
+                                                const uint8_t *dataPtr,
+                                                size_t count, uint32_t prev,
+                                                const uint64_t *live,
+                                                size_t *written) {
+  size_t n = 0;
+  for (size_t c = 0; c < count; c++) {
+    uint32_t val = _decode_data(&dataPtr, (keyPtr[c / 4] >> (2 * (c % 4))) & 0x3);
+    val += prev;
+    out[n] = val;
+    n += _is_live(live, val);
+    prev = val;
+  }
+  *written = n;
+  return dataPtr;
+}
+
+#ifdef __AVX__
+#ifdef __AVX2__
+// shuffles moving the selected 32-bit lanes (bit i of the index for lane i)
+// to the front of a register
+static const int8_t compressTable[16][16] = {
+    {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1}, // 0000
+    {0, 1, 2, 3, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},     // 0001
+    {4, 5, 6, 7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},     // 0010
+    {0, 1, 2, 3, 4, 5, 6, 7, -1, -1, -1, -1, -1, -1, -1, -1},         // 0011
+    {8, 9, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1},   // 0100
+    {0, 1, 2, 3, 8, 9, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1},       // 0101
+    {4, 5, 6, 7, 8, 9, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1},       // 0110
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, -1, -1, -1, -1},           // 0111
+    {12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1}, // 1000
+    {0, 1, 2, 3, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1},     // 1001
+    {4, 5, 6, 7, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1},     // 1010
+    {0, 1, 2, 3, 4, 5, 6, 7, 12, 13, 14, 15, -1, -1, -1, -1},         // 1011
+    {8, 9, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1},   // 1100
+    {0, 1, 2, 3, 8, 9, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1},       // 1101
+    {4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1},       // 1110
+    {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15}};          // 1111
+
+// number of selected lanes
+static const uint8_t compressCount[16] = {0, 1, 1, 2, 1, 2, 2, 3,
+                                          1, 2, 2, 3, 2, 3, 3, 4};
+
+// stores the live lanes of Vec to out, returns their number
+static inline size_t _write_avx_live(uint32_t *out, __m128i Vec,
+                                     const uint64_t *live) {
+  __m128i Words = _mm_i32gather_epi32((const int *)live, _mm_srli_epi32(Vec, 5), 4);
+  __m128i Bits = _mm_srlv_epi32(Words, _mm_and_si128(Vec, _mm_set1_epi32(31)));
+  int mask = _mm_movemask_ps(_mm_castsi128_ps(_mm_slli_epi32(Bits, 31)));
+  _write_avx(out, _mm_shuffle_epi8(
+                      Vec, _mm_loadu_si128((const __m128i *)compressTable[mask])));
+  return compressCount[mask];
+}
+#else
+// stores the live lanes of Vec to out, returns their number
+static inline size_t _write_avx_live(uint32_t *out, __m128i Vec,
+                                     const uint64_t *live) {
+  // without gathers, the lanes are tested one at a time
+  uint32_t vals[4] = {(uint32_t)_mm_cvtsi128_si32(Vec),
+                      (uint32_t)_mm_extract_epi32(Vec, 1),
+                      (uint32_t)_mm_extract_epi32(Vec, 2),
+                      (uint32_t)_mm_extract_epi32(Vec, 3)};
+  size_t n = 0;
+  for (int l = 0; l < 4; l++) {
+    out[n] = vals[l];
+    n += _is_live(live, vals[l]);
+  }
+  return n;
+}
+#endif
+
+// Same as svb_decode_avx_d1_init, except that each quad, once prefix summed,
+// is filtered through the live bitmap before being stored: out only advances
+// by the live values, whose number is stored to *written.
+static const uint8_t *svb_decode_avx_d1_live(uint32_t *out,
+                                             const uint8_t *__restrict__ keyPtr,
+                                             const uint8_t *__restrict__ dataPtr,
+                                             size_t count, uint32_t prev,
+                                             const uint64_t *live,
+                                             size_t *written) {
+  // a quad loads 16 data bytes: stop while at least 12 integers follow it
+  size_t quads = count >= 16 ? (count - 12) / 4 : 0;
+  __m128i Prev = _mm_set1_epi32(prev);
+  size_t n = 0;
+  for (size_t q = 0; q < quads; q++) {
+    Prev = _prefix_avx_d1(_decode_avx(keyPtr[q], &dataPtr), Prev);
+    n += _write_avx_live(out + n, Prev, live);
+  }
+  if (quads > 0)
+    prev = (uint32_t)_mm_extract_epi32(Prev, 3);
+  dataPtr = svb_decode_scalar_d1_live(out + n, keyPtr + quads, dataPtr,
+                                      count - 4 * quads, prev, live, written);
+  *written += n;
+  return dataPtr;
+}
+#endif
+
+// Decode count values whose keys start at keyPtr and whose data bytes start
+// at dataPtr, as differences from prev and from each other. Returns a pointer
+// to the first unused data byte.
+// Also used by the other translation units to decode slices of a stream.
+const uint8_t *svb_decode_d1(uint32_t *out, const uint8_t *keyPtr,
+                             const uint8_t *dataPtr, size_t count,
+                             uint32_t prev) {
+#if defined(__AVX2__)
+  return svb_decode_avx2_d1_init(out, keyPtr, dataPtr, count, prev);
+#elif defined(__AVX__)
+  return svb_decode_avx_d1_init(out, keyPtr, dataPtr, count, prev);
+#else
+  return svb_decode_scalar_d1_init(out, keyPtr, dataPtr, count, prev);
+#endif
+}
+
+size_t streamvbyte_delta_decode64(const uint8_t *in, uint32_t *out,
+                                  size_t count, uint32_t prev) {
+  SVB_PROBE1(delta_decode_entry, count);
+  size_t keyLen = count / 4 + (count % 4 != 0); // 2-bits per key (rounded up)
+  const uint8_t *keyPtr = in;
+  const uint8_t *dataPtr = keyPtr + keyLen; // data starts at end of keys
+  size_t bytes = svb_decode_d1(out, keyPtr, dataPtr, count, prev) - in;
+  SVB_PROBE3(delta_decode_return, count, bytes, SVB_DELTA_KERNEL_PATH);
+  return bytes;
+}
+
 size_t streamvbyte_delta_decode(const uint8_t *in, uint32_t *out,
                                 uint32_t count, uint32_t prev) {
-  uint32_t keyLen = ((count + 3) / 4); // 2-bits per key (rounded up)
+  return streamvbyte_delta_decode64(in, out, count, prev);
+}
+
+size_t streamvbyte_delta_decode_live64(const uint8_t *in, uint32_t *out,
+                                       size_t count, uint32_t prev,
+                                       const uint64_t *live, size_t *written) {
+  size_t keyLen = count / 4 + (count % 4 != 0); // 2-bits per key (rounded up)
   const uint8_t *keyPtr = in;
   const uint8_t *dataPtr = keyPtr + keyLen; // data starts at end of keys
 #ifdef __AVX__
-  return svb_decode_avx_d1_init(out, keyPtr, dataPtr, count, prev) - in;
+  return svb_decode_avx_d1_live(out, keyPtr, dataPtr, count, prev, live,
+                                written) - in;
 #else
-  return svb_decode_scalar_d1_init(out, keyPtr, dataPtr, count, prev) - in;
+  return svb_decode_scalar_d1_live(out, keyPtr, dataPtr, count, prev, live,
+                                   written) - in;
 #endif
 }
+
+size_t streamvbyte_delta_decode_live(const uint8_t *in, uint32_t *out,
+                                     uint32_t count, uint32_t prev,
+                                     const uint64_t *live, size_t *written) {
+  return streamvbyte_delta_decode_live64(in, out, count, prev, live, written);
+}
@@ -0,0 +1,239 @@
+#include "streamvbyteinterleaved.h"
+#if defined(_MSC_VER)
+/* Microsoft C/C++-compatible compiler */
+#include <intrin.h>
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+/* GCC-compatible compiler, targeting x86/x86-64 */
+#include <x86intrin.h>
+#endif
+
+#ifdef __AVX__
+
+#include "streamvbyte_shuffle_tables.h"
+
+#endif
+
+#include "streamvbyte_internal.h"
+#include <string.h> // for memcpy
+
+#define SVB_INTERLEAVED_HEADER(streams) (1 + 4 * (size_t)(streams))
+
+// number of integers of sub-stream s (out of streams) given length integers
+static inline size_t _substream_length(size_t length, size_t streams,
+                                       size_t s) {
+  size_t quads = (length + 3) / 4;
+  if (s >= quads)
+    return 0;
+  size_t count = 4 * ((quads - 1 - s) / streams + 1);
+  if ((quads - 1) % streams == s && length % 4 != 0)
+    count -= 4 - length % 4; // the last quad is short
+  return count;
+}
+
+size_t streamvbyte_interleaved_encode(const uint32_t *in, uint32_t length,
+                                      uint8_t *out, int streams) {
+  if (streams < 1 || streams > STREAMVBYTE_INTERLEAVED_MAX_STREAMS)
+    return 0;
+  out[0] = (uint8_t)streams;
+  uint8_t *p = out + SVB_INTERLEAVED_HEADER(streams);
+  // integers not encoded yet, in the order of the compressed data
+  size_t left = length;
+  for (int s = 0; s < streams; s++) {
+    size_t count = _substream_length(length, streams, s);
+    uint8_t *keyPtr = p;
+    uint8_t *dataPtr = keyPtr + (count + 3) / 4;
+    for (size_t q = s; 4 * q < length; q += streams) {
+      size_t n = length - 4 * q < 4 ? length - 4 * q : 4;
+      left -= n;
+#ifdef __AVX__
+      // streamvbyte_encode4 stores 16 bytes, up to 12 bytes past the data
+      // of the quad: at least 12 more integers (so at least 12 more bytes)
+      // must follow in the compressed data (see svb_encode)
+      if (n == 4 && left >= 12) {
+        __m128i vin = _mm_loadu_si128((const __m128i *)(in + 4 * q));
+        dataPtr += streamvbyte_encode4(vin, dataPtr, keyPtr++);
+        continue;
+      }
+#endif
+      dataPtr = svb_encode(in + 4 * q, keyPtr++, dataPtr, n);
+    }
+    uint32_t size = (uint32_t)(dataPtr - p);
+    memcpy(out + 1 + 4 * s, &size, sizeof(size)); // assumes little endian
+    p = dataPtr;
+  }
+  return p - out;
+}
+
+static inline uint32_t _decode_data(const uint8_t **dataPtrPtr, uint8_t code) {
+  const uint8_t *dataPtr = *dataPtrPtr;
+  uint32_t val;
+
+  if (code == 0) { // 1 byte
+    val = (uint32_t)*dataPtr;
+    dataPtr += 1;
+  } else if (code == 1) { // 2 bytes
+    val = 0;
+    memcpy(&val, dataPtr, 2); // assumes little endian
+    dataPtr += 2;
+  } else if (code == 2) { // 3 bytes
+    val = 0;
+    memcpy(&val, dataPtr, 3); // assumes little endian
+    dataPtr += 3;
+  } else { // code == 3
+    memcpy(&val, dataPtr, 4);
+    dataPtr += 4;
+  }
+
+  *dataPtrPtr = dataPtr;
+  return val;
+}
+
+// decodes the n <= 4 integers of a quad described by key
+static inline void _decode_quad_scalar(uint8_t key, const uint8_t **dataPtrPtr,
+                                       uint32_t *out, size_t n) {
+  for (size_t i = 0; i < n; i++)
+    out[i] = _decode_data(dataPtrPtr, (key >> (2 * i)) & 0x3);
+}
+
+#ifdef __AVX__
+
+static inline __m128i _decode_avx(uint32_t key,
+                                  const uint8_t *__restrict__ *dataPtrPtr) {
+  __m128i Data = _mm_loadu_si128((__m128i *)*dataPtrPtr);
+  __m128i Shuf = *(__m128i *)&shuffleTable[key];
+  *dataPtrPtr += lengthTable[key];
+  return _mm_shuffle_epi8(Data, Shuf);
+}
+
+static inline void _write_avx(uint32_t *out, __m128i Vec) {
+  _mm_storeu_si128((__m128i *)out, Vec);
+}
+
+#endif
+
+// The decoders of rounds (one full quad from each sub-stream): they decode
+// the rounds that can be read with 16-byte loads without going past end,
+// advancing the data pointers of the sub-streams side by side, and return
+// the number of rounds decoded. The data of the last sub-stream comes after
+// the data of all others, so only its pointer is checked against end.
+
+#ifdef __AVX__
+
+static size_t _decode_rounds2(const uint8_t *const *keyPtrs,
+                              const uint8_t **dataPtrs, size_t rounds,
+                              const uint8_t *end, uint32_t *out) {
+  const uint8_t *p0 = dataPtrs[0], *p1 = dataPtrs[1];
+  size_t r = 0;
+  // 8 rounds at a time read at most 8 * 16 bytes from p1
+  for (; r + 8 <= rounds && p1 + 8 * 16 <= end; r += 8) {
+    uint64_t keys0, keys1;
+    memcpy(&keys0, keyPtrs[0] + r, sizeof(keys0));
+    memcpy(&keys1, keyPtrs[1] + r, sizeof(keys1));
+    for (int i = 0; i < 8; i++) {
+      __m128i Data0 = _decode_avx(keys0 & 0xFF, &p0);
+      __m128i Data1 = _decode_avx(keys1 & 0xFF, &p1);
+      _write_avx(out, Data0);
+      _write_avx(out + 4, Data1);
+      keys0 >>= 8;
+      keys1 >>= 8;
+      out += 8;
+    }
+  }
+  dataPtrs[0] = p0;
+  dataPtrs[1] = p1;
+  return r;
+}
+
+static size_t _decode_rounds4(const uint8_t *const *keyPtrs,
+                              const uint8_t **dataPtrs, size_t rounds,
+                              const uint8_t *end, uint32_t *out) {
+  const uint8_t *p0 = dataPtrs[0], *p1 = dataPtrs[1];
+  const uint8_t *p2 = dataPtrs[2], *p3 = dataPtrs[3];
+  size_t r = 0;
+  for (; r + 8 <= rounds && p3 + 8 * 16 <= end; r += 8) {
+    uint64_t keys0, keys1, keys2, keys3;
+    memcpy(&keys0, keyPtrs[0] + r, sizeof(keys0));
+    memcpy(&keys1, keyPtrs[1] + r, sizeof(keys1));
+    memcpy(&keys2, keyPtrs[2] + r, sizeof(keys2));
+    memcpy(&keys3, keyPtrs[3] + r, sizeof(keys3));
+    for (int i = 0; i < 8; i++) {
+      __m128i Data0 = _decode_avx(keys0 & 0xFF, &p0);
+      __m128i Data1 = _decode_avx(keys1 & 0xFF, &p1);
+      __m128i Data2 = _decode_avx(keys2 & 0xFF, &p2);
+      __m128i Data3 = _decode_avx(keys3 & 0xFF, &p3);
+      _write_avx(out, Data0);
+      _write_avx(out + 4, Data1);
+      _write_avx(out + 8, Data2);
+      _write_avx(out + 12, Data3);
+      keys0 >>= 8;
+      keys1 >>= 8;
+      keys2 >>= 8;
+      keys3 >>= 8;
+      out += 16;
+    }
+  }
+  dataPtrs[0] = p0;
+  dataPtrs[1] = p1;
+  dataPtrs[2] = p2;
+  dataPtrs[3] = p3;
+  return r;
+}
+
+#endif
+
+// any number of sub-streams, one round at a time from round r
+static size_t _decode_rounds(const uint8_t *const *keyPtrs,
+                             const uint8_t **dataPtrs, size_t streams,
+                             size_t r, size_t rounds, const uint8_t *end,
+                             uint32_t *out) {
+  out += 4 * streams * r;
+#ifdef __AVX__
+  for (; r < rounds && dataPtrs[streams - 1] + 16 <= end; r++) {
+    for (size_t s = 0; s < streams; s++)
+      _write_avx(out + 4 * s, _decode_avx(keyPtrs[s][r], &dataPtrs[s]));
+    out += 4 * streams;
+  }
+#else
+  (void)end; // the scalar code reads no byte past the data
+  for (; r < rounds; r++) {
+    for (size_t s = 0; s < streams; s++)
+      _decode_quad_scalar(keyPtrs[s][r], &dataPtrs[s], out + 4 * s, 4);
+    out += 4 * streams;
+  }
+#endif
+  return r;
+}
+
+size_t streamvbyte_interleaved_decode(const uint8_t *in, uint32_t *out,
+                                      uint32_t length) {
+  size_t streams = in[0];
+  const uint8_t *keyPtrs[STREAMVBYTE_INTERLEAVED_MAX_STREAMS];
+  const uint8_t *dataPtrs[STREAMVBYTE_INTERLEAVED_MAX_STREAMS];
+  const uint8_t *p = in + SVB_INTERLEAVED_HEADER(streams);
+  for (size_t s = 0; s < streams; s++) {
+    uint32_t size;
+    memcpy(&size, in + 1 + 4 * s, sizeof(size)); // assumes little endian
+    keyPtrs[s] = p;
+    dataPtrs[s] = p + (_substream_length(length, streams, s) + 3) / 4;
+    p += size;
+  }
+  const uint8_t *end = p;
+
+  size_t rounds = (length / 4) / streams; // all sub-streams have full quads
+  size_t r = 0;
+#ifdef __AVX__
+  if (streams == 4)
+    r = _decode_rounds4(keyPtrs, dataPtrs, rounds, end, out);
+  else if (streams == 2)
+    r = _decode_rounds2(keyPtrs, dataPtrs, rounds, end, out);
+#endif
+  r = _decode_rounds(keyPtrs, dataPtrs, streams, r, rounds, end, out);
+
+  // the remaining quads, in order
+  for (size_t q = r * streams; 4 * q < length; q++) {
+    size_t s = q % streams;
+    size_t n = length - 4 * q < 4 ? length - 4 * q : 4;
+    _decode_quad_scalar(keyPtrs[s][q / streams], &dataPtrs[s], out + 4 * q, n);
+  }
+  return end - in;
+}
@@ -0,0 +1,218 @@
+#include "streamvbytepostings.h"
+#if defined(_MSC_VER)
+/* Microsoft C/C++-compatible compiler */
+#include <intrin.h>
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+/* GCC-compatible compiler, targeting x86/x86-64 */
+#include <x86intrin.h>
+#endif
+
+#ifdef __AVX__
+
+#include "streamvbyte_shuffle_tables.h"
+#include "streamvbyte_delta_kernels.h"
+
+#endif
+
+#include "streamvbyte_internal.h"
+#include <string.h> // for memcpy
+
+size_t streamvbyte_postings_encode(const uint32_t *docids, const uint32_t *freqs,
+                                   uint32_t length, uint8_t *out, uint32_t prev) {
+  uint32_t deltas[STREAMVBYTE_POSTINGS_BLOCK];
+  uint8_t *p = out;
+  // row is a size_t so that row + STREAMVBYTE_POSTINGS_BLOCK cannot wrap
+  for (size_t row = 0; row < length; row += STREAMVBYTE_POSTINGS_BLOCK) {
+    uint32_t count = (uint32_t)(length - row);
+    if (count > STREAMVBYTE_POSTINGS_BLOCK)
+      count = STREAMVBYTE_POSTINGS_BLOCK;
+    for (uint32_t i = 0; i < count; i++) {
+      deltas[i] = docids[row + i] - prev;
+      prev = docids[row + i];
+    }
+    uint32_t keyLen = (count + 3) / 4; // 2-bits rounded to full byte
+    uint8_t *docKeys = p + 2;
+    uint8_t *freqKeys = docKeys + keyLen;
+    uint8_t *docData = freqKeys + keyLen;
+    uint8_t *freqData = svb_encode(deltas, docKeys, docData, count);
+    uint16_t docBytes = (uint16_t)(freqData - docData); // at most 512
+    memcpy(p, &docBytes, sizeof(docBytes)); // assumes little endian
+    p = svb_encode(freqs + row, freqKeys, freqData, count);
+  }
+  return p - out;
+}
+
+static inline uint32_t _decode_data(const uint8_t **dataPtrPtr, uint8_t code) {
+  const uint8_t *dataPtr = *dataPtrPtr;
+  uint32_t val;
+
+  if (code == 0) { // 1 byte
+    val = (uint32_t)*dataPtr;
+    dataPtr += 1;
+  } else if (code == 1) { // 2 bytes
+    val = 0;
+    memcpy(&val, dataPtr, 2); // assumes little endian
+    dataPtr += 2;
+  } else if (code == 2) { // 3 bytes
+    val = 0;
+    memcpy(&val, dataPtr, 3); // assumes little endian
+    dataPtr += 3;
+  } else { // code == 3
+    memcpy(&val, dataPtr, 4);
+    dataPtr += 4;
+  }
+
+  *dataPtrPtr = dataPtr;
+  return val;
+}
+
+#ifdef __AVX__
+#ifdef __AVX2__
+typedef __m256i svb_prev_t; // previous document identifier in every lane
+#define _prev_set1 _mm256_set1_epi32
+#define _prev_xmm _mm256_castsi256_si128
+
+// Decodes the 32 document identifiers described by the 64-bit word of keys.
+static inline __m256i _decode_avx_docs(uint64_t keys, uint32_t *docids,
+                                       const uint8_t **dataPtr, __m256i Prev) {
+  const uint8_t *data = *dataPtr;
+  if (keys == 0) { // 32 1-byte differences in a row
+    __m256i Docs = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *)data));
+    Prev = _write_16bit_avx2_d1(docids, Docs, Prev);
+    Docs = _mm256_cvtepu8_epi16(_mm_loadu_si128((__m128i *)(data + 16)));
+    Prev = _write_16bit_avx2_d1(docids + 16, Docs, Prev);
+    *dataPtr = data + 32;
+    return Prev;
+  }
+  for (int i = 0; i < 32; i += 8, keys >>= 16)
+    Prev = _write_avx2_d1(docids + i, _decode_avx2(keys, &data), Prev);
+  *dataPtr = data;
+  return Prev;
+}
+#else
+typedef __m128i svb_prev_t; // previous document identifier in the last lane
+#define _prev_set1 _mm_set1_epi32
+#define _prev_xmm(Prev) (Prev)
+
+// Decodes the 32 document identifiers described by the 64-bit word of keys.
+static inline __m128i _decode_avx_docs(uint64_t keys, uint32_t *docids,
+                                       const uint8_t **dataPtr, __m128i Prev) {
+  const uint8_t *data = *dataPtr;
+  if (keys == 0) { // 32 1-byte differences in a row
+    for (int i = 0; i < 32; i += 8) {
+      __m128i Docs = _mm_cvtepu8_epi16(_mm_loadl_epi64((__m128i *)(data + i)));
+      Prev = _write_16bit_avx_d1(docids + i, Docs, Prev);
+    }
+    *dataPtr = data + 32;
+    return Prev;
+  }
+  for (int i = 0; i < 32; i += 4, keys >>= 8)
+    Prev = _write_avx_d1(docids + i, _decode_avx(keys & 0xFF, &data), Prev);
+  *dataPtr = data;
+  return Prev;
+}
+#endif
+
+// Decodes the 32 frequencies described by the 64-bit word of keys.
+static inline void _decode_avx_freqs(uint64_t keys, uint32_t *freqs,
+                                     const uint8_t **dataPtr) {
+  const uint8_t *data = *dataPtr;
+  if (keys == 0) { // 32 1-byte integers in a row
+    for (int i = 0; i < 32; i += 4) {
+      int quad;
+      memcpy(&quad, data + i, sizeof(quad));
+      _mm_storeu_si128((__m128i *)(freqs + i),
+                       _mm_cvtepu8_epi32(_mm_cvtsi32_si128(quad)));
+    }
+    *dataPtr = data + 32;
+    return;
+  }
+  for (int i = 0; i < 32; i += 4, keys >>= 8)
+    _mm_storeu_si128((__m128i *)(freqs + i), _decode_avx(keys & 0xFF, &data));
+  *dataPtr = data;
+}
+
+// Decodes the 32 pairs described by the 64-bit words of keys docKeys and
+// freqKeys. The two pipelines are independent: once inlined, the out of
+// order core overlaps the table lookups and the prefix sums of the document
+// identifiers with the decoding of the frequencies.
+static inline svb_prev_t _decode_avx_word(uint64_t docKeys, uint64_t freqKeys,
+                                          uint32_t *docids, uint32_t *freqs,
+                                          const uint8_t **docDataPtr,
+                                          const uint8_t **freqDataPtr,
+                                          svb_prev_t Prev) {
+  _decode_avx_freqs(freqKeys, freqs, freqDataPtr);
+  return _decode_avx_docs(docKeys, docids, docDataPtr, Prev);
+}
+#endif
+
+// Decodes a block of count pairs, followed in the stream by at least "after"
+// bytes. A 16-byte load is safe when 12 more bytes follow the quad loaded.
+// The data of the frequencies comes last in the block and every frequency
+// takes at least a byte, so at least count - 4 * (q + 1) + after bytes
+// follow the frequencies of quad q (and more the document identifiers).
+static const uint8_t *_decode_block(const uint8_t *p, uint32_t *docids,
+                                    uint32_t *freqs, uint32_t count,
+                                    uint32_t *prev, size_t after) {
+  uint16_t docBytes;
+  memcpy(&docBytes, p, sizeof(docBytes)); // assumes little endian
+  uint32_t keyLen = (count + 3) / 4; // 2-bits per key (rounded up)
+  const uint8_t *docKeys = p + 2;
+  const uint8_t *freqKeys = docKeys + keyLen;
+  const uint8_t *docData = freqKeys + keyLen;
+  const uint8_t *freqData = docData + docBytes;
+  uint32_t c = 0;
+  uint32_t val = *prev;
+#ifdef __AVX__
+  uint32_t nquads = count / 4;
+  if (count + after < 12)
+    nquads = 0;
+  else if ((count + after - 12) / 4 < nquads)
+    nquads = (uint32_t)((count + after - 12) / 4);
+  if (nquads > 0) {
+    svb_prev_t Prev = _prev_set1(val);
+    uint32_t q = 0;
+    for (; q + 8 <= nquads; q += 8) {
+      uint64_t dk, fk;
+      memcpy(&dk, docKeys + q, sizeof(dk));
+      memcpy(&fk, freqKeys + q, sizeof(fk));
+      Prev = _decode_avx_word(dk, fk, docids + 4 * q, freqs + 4 * q, &docData,
+                              &freqData, Prev);
+    }
+    __m128i Last = _prev_xmm(Prev);
+    for (; q < nquads; q++) {
+      __m128i Docs = _decode_avx(docKeys[q], &docData);
+      __m128i Freqs = _decode_avx(freqKeys[q], &freqData);
+      Last = _write_avx_d1(docids + 4 * q, Docs, Last);
+      _mm_storeu_si128((__m128i *)(freqs + 4 * q), Freqs);
+    }
+    c = 4 * nquads;
+    val = docids[c - 1];
+  }
+#else
+  (void)after;
+#endif
+  for (; c < count; c++) {
+    uint8_t shift = 2 * (c % 4);
+    val += _decode_data(&docData, (docKeys[c / 4] >> shift) & 0x3);
+    docids[c] = val;
+    freqs[c] = _decode_data(&freqData, (freqKeys[c / 4] >> shift) & 0x3);
+  }
+  *prev = val;
+  return freqData;
+}
+
+size_t streamvbyte_postings_decode(const uint8_t *in, uint32_t *docids, uint32_t *freqs,
+                                   uint32_t length, uint32_t prev) {
+  const uint8_t *p = in;
+  // row is a size_t so that row + STREAMVBYTE_POSTINGS_BLOCK cannot wrap
+  for (size_t row = 0; row < length; row += STREAMVBYTE_POSTINGS_BLOCK) {
+    uint32_t count = (uint32_t)(length - row);
+    if (count > STREAMVBYTE_POSTINGS_BLOCK)
+      count = STREAMVBYTE_POSTINGS_BLOCK;
+    // every pair of the following blocks takes at least 2 bytes
+    p = _decode_block(p, docids + row, freqs + row, count, &prev,
+                      2 * (length - row - count));
+  }
+  return p - in;
+}
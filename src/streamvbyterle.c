@@ -0,0 +1,230 @@
+#include "streamvbyterle.h"
+#include "streamvbyte.h"
+#if defined(_MSC_VER)
+/* Microsoft C/C++-compatible compiler */
+#include <intrin.h>
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+/* GCC-compatible compiler, targeting x86/x86-64 */
+#include <x86intrin.h>
+#endif
+
+#ifdef __AVX__
+
+#include "streamvbyte_shuffle_tables.h"
+
+#endif
+
+#include "streamvbyte_internal.h"
+#include <string.h> // for memcpy, memmove
+
+// a literal entry holds 1 to 128 control bytes
+#define SVB_RLE_MAX_LITERAL 128
+// a run entry repeats a control byte 3 to 130 times (shorter runs are
+// cheaper as literals)
+#define SVB_RLE_MIN_RUN 3
+#define SVB_RLE_MAX_RUN 130
+
+// length of the run of identical bytes starting at keys[0], at most maxrun
+static size_t _run_length(const uint8_t *keys, size_t available,
+                          size_t maxrun) {
+  size_t run = 1;
+  if (available > maxrun)
+    available = maxrun;
+  while (run < available && keys[run] == keys[0])
+    run++;
+  return run;
+}
+
+size_t streamvbyte_rle_encode(const uint32_t *in, uint32_t length,
+                              uint8_t *out) {
+  size_t keyLen = ((size_t)length + 3) / 4; // 2-bits rounded to full byte
+  // We first produce the regular format "slack" bytes into the buffer, then
+  // write the entries from the start of the buffer, reading the control
+  // bytes ahead of where we write: the entries written so far never take
+  // more than one byte per control byte read, plus one header per literal
+  // of 128 bytes and one header for the literal in progress.
+  size_t slack = keyLen / SVB_RLE_MAX_LITERAL + 2;
+  const uint8_t *keys = out + slack;
+  size_t compsize =
+      svb_encode(in, out + slack, out + slack + keyLen, length) - (out + slack);
+  size_t dataLen = compsize - keyLen;
+
+  uint8_t *p = out;
+  size_t r = 0;
+  while (r < keyLen) {
+    size_t run = _run_length(keys + r, keyLen - r, SVB_RLE_MAX_RUN);
+    if (run >= SVB_RLE_MIN_RUN) {
+      uint8_t key = keys[r];
+      *p++ = (uint8_t)(run + 125);
+      *p++ = key;
+      r += run;
+      continue;
+    }
+    // literal: extends until the next run worth coding
+    size_t literal = run;
+    while (r + literal < keyLen && literal < SVB_RLE_MAX_LITERAL) {
+      run = _run_length(keys + r + literal, keyLen - r - literal,
+                        SVB_RLE_MIN_RUN);
+      if (run >= SVB_RLE_MIN_RUN)
+        break;
+      literal += run;
+    }
+    if (literal > SVB_RLE_MAX_LITERAL)
+      literal = SVB_RLE_MAX_LITERAL;
+    *p++ = (uint8_t)(literal - 1);
+    memmove(p, keys + r, literal);
+    p += literal;
+    r += literal;
+  }
+  memmove(p, keys + keyLen, dataLen);
+  return (p - out) + dataLen;
+}
+
+static inline uint32_t _decode_data(const uint8_t **dataPtrPtr, uint8_t code) {
+  const uint8_t *dataPtr = *dataPtrPtr;
+  uint32_t val;
+
+  if (code == 0) { // 1 byte
+    val = (uint32_t)*dataPtr;
+    dataPtr += 1;
+  } else if (code == 1) { // 2 bytes
+    val = 0;
+    memcpy(&val, dataPtr, 2); // assumes little endian
+    dataPtr += 2;
+  } else if (code == 2) { // 3 bytes
+    val = 0;
+    memcpy(&val, dataPtr, 3); // assumes little endian
+    dataPtr += 3;
+  } else { // code == 3
+    memcpy(&val, dataPtr, 4);
+    dataPtr += 4;
+  }
+
+  *dataPtrPtr = dataPtr;
+  return val;
+}
+
+// decodes the first n (at most 4) integers described by key
+static inline const uint8_t *_decode_quad_scalar(uint8_t key, uint32_t *out,
+                                                 size_t n,
+                                                 const uint8_t *dataPtr) {
+  for (size_t i = 0; i < n; i++)
+    out[i] = _decode_data(&dataPtr, (key >> (2 * i)) & 0x3);
+  return dataPtr;
+}
+
+typedef struct {
+  uint32_t *out;
+  const uint8_t *dataPtr;
+  size_t quad;       // index of the next quad
+  size_t vectorquads; // quads below this index can use 16-byte loads
+  size_t length;
+} svb_rle_state_t;
+
+// decodes the quads of a literal entry
+static inline void _decode_literal(svb_rle_state_t *s, const uint8_t *keys,
+                                   size_t n) {
+  // local copies: the stores to out could otherwise alias the state
+  uint32_t *out = s->out;
+  const uint8_t *dataPtr = s->dataPtr;
+  size_t i = 0;
+#ifdef __AVX__
+  size_t vectorquads = s->vectorquads > s->quad ? s->vectorquads - s->quad : 0;
+  size_t n_vector = n < vectorquads ? n : vectorquads;
+  for (; i < n_vector; i++) {
+    __m128i Data = _mm_loadu_si128((__m128i *)dataPtr);
+    __m128i Shuf = _mm_loadu_si128((__m128i *)shuffleTable[keys[i]]);
+    _mm_storeu_si128((__m128i *)(out + 4 * i), _mm_shuffle_epi8(Data, Shuf));
+    dataPtr += lengthTable[keys[i]];
+  }
+#endif
+  for (; i < n; i++) {
+    size_t remaining = s->length - 4 * (s->quad + i);
+    dataPtr = _decode_quad_scalar(keys[i], out + 4 * i,
+                                  remaining < 4 ? remaining : 4, dataPtr);
+  }
+  s->dataPtr = dataPtr;
+  s->out = out + 4 * n;
+  s->quad += n;
+}
+
+// decodes the n quads of a run entry: every quad has the same length, so
+// the shuffle and the length are looked up once and the loads are
+// independent
+static inline void _decode_run(svb_rle_state_t *s, uint8_t key, size_t n) {
+  // local copies: the stores to out could otherwise alias the state
+  uint32_t *out = s->out;
+  const uint8_t *dataPtr = s->dataPtr;
+  size_t i = 0;
+#ifdef __AVX__
+  size_t vectorquads = s->vectorquads > s->quad ? s->vectorquads - s->quad : 0;
+  size_t n_vector = n < vectorquads ? n : vectorquads;
+  size_t len = lengthTable[key];
+  __m128i Shuf = _mm_loadu_si128((__m128i *)shuffleTable[key]);
+  for (; i + 4 <= n_vector; i += 4) {
+    __m128i Data0 = _mm_loadu_si128((__m128i *)dataPtr);
+    __m128i Data1 = _mm_loadu_si128((__m128i *)(dataPtr + len));
+    __m128i Data2 = _mm_loadu_si128((__m128i *)(dataPtr + 2 * len));
+    __m128i Data3 = _mm_loadu_si128((__m128i *)(dataPtr + 3 * len));
+    __m128i *o = (__m128i *)(out + 4 * i);
+    _mm_storeu_si128(o, _mm_shuffle_epi8(Data0, Shuf));
+    _mm_storeu_si128(o + 1, _mm_shuffle_epi8(Data1, Shuf));
+    _mm_storeu_si128(o + 2, _mm_shuffle_epi8(Data2, Shuf));
+    _mm_storeu_si128(o + 3, _mm_shuffle_epi8(Data3, Shuf));
+    dataPtr += 4 * len;
+  }
+  for (; i < n_vector; i++) {
+    __m128i Data = _mm_loadu_si128((__m128i *)dataPtr);
+    _mm_storeu_si128((__m128i *)(out + 4 * i), _mm_shuffle_epi8(Data, Shuf));
+    dataPtr += len;
+  }
+#endif
+  for (; i < n; i++) {
+    size_t remaining = s->length - 4 * (s->quad + i);
+    dataPtr = _decode_quad_scalar(key, out + 4 * i,
+                                  remaining < 4 ? remaining : 4, dataPtr);
+  }
+  s->dataPtr = dataPtr;
+  s->out = out + 4 * n;
+  s->quad += n;
+}
+
+size_t streamvbyte_rle_decode(const uint8_t *in, uint32_t *out,
+                              uint32_t length) {
+  if (length == 0)
+    return 0;
+
+  size_t keyLen = ((size_t)length + 3) / 4; // 2-bits per key (rounded up)
+
+  // the data bytes start after the last entry
+  const uint8_t *p = in;
+  for (size_t covered = 0; covered < keyLen;) {
+    uint8_t h = *p;
+    if (h < SVB_RLE_MAX_LITERAL) {
+      covered += h + 1;
+      p += h + 2;
+    } else {
+      covered += h - 125;
+      p += 2;
+    }
+  }
+
+  svb_rle_state_t s;
+  s.out = out;
+  s.dataPtr = p;
+  s.quad = 0;
+  s.length = length;
+  // a 16-byte load is safe as long as 12 more integers (bytes) follow
+  s.vectorquads = length >= 16 ? (length - 12) / 4 : 0;
+  p = in;
+  while (s.quad < keyLen) {
+    uint8_t h = *p++;
+    if (h < SVB_RLE_MAX_LITERAL) {
+      _decode_literal(&s, p, h + 1);
+      p += h + 1;
+    } else {
+      _decode_run(&s, *p++, h - 125);
+    }
+  }
+  return s.dataPtr - in;
+}
@@ -0,0 +1,374 @@
+#include "streamvbyteseries.h"
+#include "streamvbyte.h"
+#if defined(_MSC_VER)
+/* Microsoft C/C++-compatible compiler */
+#include <intrin.h>
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+/* GCC-compatible compiler, targeting x86/x86-64 */
+#include <x86intrin.h>
+#endif
+
+#include "streamvbyte_internal.h"
+#include <string.h> // for memcpy, memmove
+
+// a compressed chunk: its timestamps (zigzag deltas of the deltas of their
+// offsets from the first one), then its values (zigzag deltas)
+typedef struct {
+  uint64_t first; // first timestamp
+  uint64_t last;  // last timestamp
+  size_t offset;  // start of the chunk in the ring
+  size_t bytes;   // compressed bytes
+  uint32_t count; // number of samples
+} svb_series_chunk_t;
+
+struct streamvbyte_series_s {
+  uint64_t duration;
+  uint32_t maxsamples;
+  uint32_t maxchunks;
+  // index of the compressed chunks: a ring of maxchunks entries, oldest first
+  svb_series_chunk_t *chunks;
+  uint32_t first;   // oldest chunk
+  uint32_t nchunks;
+  // compressed chunks: a ring of capacity bytes, from the offset of the
+  // oldest chunk to tail (wrapping around when tail is not past it)
+  uint8_t *ring;
+  size_t capacity;
+  size_t tail;
+  size_t used;      // bytes of the compressed chunks
+  size_t samples;   // samples of the compressed chunks
+  // head chunk, uncompressed
+  uint64_t window;  // start of its window
+  uint32_t nhead;
+  uint64_t *headtimestamps;
+  uint32_t *headvalues;
+  uint32_t *scratch; // maxsamples integers, to encode the head chunk
+};
+
+static inline uint32_t _zigzag(uint32_t val) {
+  return (val << 1) ^ (0 - (val >> 31));
+}
+
+static inline uint32_t _unzigzag(uint32_t val) {
+  return (val >> 1) ^ (0 - (val & 1));
+}
+
+static inline uint8_t *_align(uint8_t *p) {
+  return p + ((sizeof(uint64_t) - (uintptr_t)p % sizeof(uint64_t)) % sizeof(uint64_t));
+}
+
+static inline svb_series_chunk_t *_chunk(const streamvbyte_series_t *series,
+                                         size_t i) {
+  return &series->chunks[(series->first + i) % series->maxchunks];
+}
+
+streamvbyte_series_t *streamvbyte_series_init(void *mem, size_t bytes,
+                                              uint64_t duration,
+                                              uint32_t maxsamples,
+                                              uint32_t maxchunks) {
+  if (duration == 0 || duration > ((uint64_t)1 << 31) || maxsamples == 0 ||
+      maxchunks == 0)
+    return NULL;
+  uint8_t *begin = (uint8_t *)mem;
+  uint8_t *p = _align(begin);
+  streamvbyte_series_t *series = (streamvbyte_series_t *)p;
+  p = _align(p + sizeof(streamvbyte_series_t));
+  svb_series_chunk_t *chunks = (svb_series_chunk_t *)p;
+  p += (size_t)maxchunks * sizeof(svb_series_chunk_t);
+  uint64_t *headtimestamps = (uint64_t *)p;
+  p += (size_t)maxsamples * sizeof(uint64_t);
+  uint32_t *headvalues = (uint32_t *)p;
+  p += (size_t)maxsamples * sizeof(uint32_t);
+  uint32_t *scratch = (uint32_t *)p;
+  p += (size_t)maxsamples * sizeof(uint32_t);
+  size_t fixed = (size_t)(p - begin);
+  // the largest chunk: both of its streams at their largest
+  if (bytes < fixed ||
+      bytes - fixed < 2 * streamvbyte_max_compressedbytes(maxsamples))
+    return NULL;
+
+  memset(series, 0, sizeof(streamvbyte_series_t));
+  series->duration = duration;
+  series->maxsamples = maxsamples;
+  series->maxchunks = maxchunks;
+  series->chunks = chunks;
+  series->ring = p;
+  series->capacity = bytes - fixed;
+  series->headtimestamps = headtimestamps;
+  series->headvalues = headvalues;
+  series->scratch = scratch;
+  return series;
+}
+
+// finds room for need bytes in the ring, after the newest chunk
+static int _reserve(const streamvbyte_series_t *series, size_t need,
+                    size_t *offset) {
+  if (series->nchunks == 0) {
+    *offset = 0;
+    return need <= series->capacity ? 0 : -1;
+  }
+  size_t head = _chunk(series, 0)->offset;
+  if (series->tail > head) { // not wrapped: free at the end, then before head
+    if (series->capacity - series->tail >= need)
+      *offset = series->tail;
+    else if (head >= need)
+      *offset = 0;
+    else
+      return -1;
+  } else { // wrapped: free between tail and head
+    if (head - series->tail < need)
+      return -1;
+    *offset = series->tail;
+  }
+  return 0;
+}
+
+// compresses the head chunk, which is not empty
+static int _compress(streamvbyte_series_t *series) {
+  uint32_t n = series->nhead;
+  size_t offset;
+  // a chunk only goes where it fits at its largest
+  if (series->nchunks == series->maxchunks ||
+      _reserve(series, 2 * streamvbyte_max_compressedbytes(n), &offset) != 0)
+    return -1;
+  const uint64_t *timestamps = series->headtimestamps;
+  uint32_t *scratch = series->scratch;
+  uint8_t *out = series->ring + offset;
+  // the offsets from the first timestamp fit in 32 bits (within a window)
+  uint32_t prevoffset = 0, prevdelta = 0;
+  for (uint32_t i = 0; i < n; i++) {
+    uint32_t off = (uint32_t)(timestamps[i] - timestamps[0]);
+    uint32_t delta = off - prevoffset;
+    scratch[i] = _zigzag(delta - prevdelta);
+    prevdelta = delta;
+    prevoffset = off;
+  }
+  size_t keyLen = n / 4 + (n % 4 != 0); // 2-bits rounded to full byte
+  size_t bytes = svb_encode(scratch, out, out + keyLen, n) - out;
+  uint32_t prev = 0;
+  for (uint32_t i = 0; i < n; i++) {
+    scratch[i] = _zigzag(series->headvalues[i] - prev);
+    prev = series->headvalues[i];
+  }
+  bytes = svb_encode(scratch, out + bytes, out + bytes + keyLen, n) - out;
+
+  svb_series_chunk_t *chunk = _chunk(series, series->nchunks);
+  chunk->first = timestamps[0];
+  chunk->last = timestamps[n - 1];
+  chunk->offset = offset;
+  chunk->bytes = bytes;
+  chunk->count = n;
+  series->nchunks++;
+  series->tail = offset + bytes;
+  series->used += bytes;
+  series->samples += n;
+  series->nhead = 0;
+  return 0;
+}
+
+int streamvbyte_series_append(streamvbyte_series_t *series, uint64_t timestamp,
+                              uint32_t value) {
+  if (series->nhead > 0) {
+    if (timestamp < series->headtimestamps[series->nhead - 1])
+      return -1;
+    if ((series->nhead == series->maxsamples ||
+         timestamp - series->window >= series->duration) &&
+        _compress(series) != 0)
+      return -1;
+  } else if (series->nchunks > 0 &&
+             timestamp < _chunk(series, series->nchunks - 1)->last) {
+    return -1;
+  }
+  if (series->nhead == 0)
+    series->window = timestamp - timestamp % series->duration;
+  series->headtimestamps[series->nhead] = timestamp;
+  series->headvalues[series->nhead] = value;
+  series->nhead++;
+  return 0;
+}
+
+int streamvbyte_series_flush(streamvbyte_series_t *series) {
+  return series->nhead > 0 ? _compress(series) : 0;
+}
+
+size_t streamvbyte_series_drop_before(streamvbyte_series_t *series,
+                                      uint64_t timestamp) {
+  size_t dropped = 0;
+  while (series->nchunks > 0 && _chunk(series, 0)->last < timestamp) {
+    svb_series_chunk_t *chunk = _chunk(series, 0);
+    dropped += chunk->count;
+    series->samples -= chunk->count;
+    series->used -= chunk->bytes;
+    series->first = (series->first + 1) % series->maxchunks;
+    series->nchunks--;
+  }
+  if (series->nchunks == 0) {
+    series->tail = 0;
+    if (series->nhead > 0 &&
+        series->headtimestamps[series->nhead - 1] < timestamp) {
+      dropped += series->nhead;
+      series->nhead = 0;
+    }
+  }
+  return dropped;
+}
+
+size_t streamvbyte_series_count(const streamvbyte_series_t *series) {
+  return series->samples + series->nhead;
+}
+
+size_t streamvbyte_series_compressedbytes(const streamvbyte_series_t *series) {
+  return series->used;
+}
+
+// returns the first chunk whose last timestamp is at least from
+static size_t _first_chunk(const streamvbyte_series_t *series, uint64_t from) {
+  size_t lo = 0, hi = series->nchunks;
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    if (_chunk(series, mid)->last < from)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return lo;
+}
+
+// returns the number of timestamps smaller than t
+static size_t _lower_bound(const uint64_t *timestamps, size_t n, uint64_t t) {
+  size_t lo = 0, hi = n;
+  while (lo < hi) {
+    size_t mid = lo + (hi - lo) / 2;
+    if (timestamps[mid] < t)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  return lo;
+}
+
+size_t streamvbyte_series_query_bound(const streamvbyte_series_t *series,
+                                      uint64_t from, uint64_t to) {
+  size_t bound = 0;
+  if (from >= to)
+    return 0;
+  for (size_t i = _first_chunk(series, from); i < series->nchunks; i++) {
+    const svb_series_chunk_t *chunk = _chunk(series, i);
+    if (chunk->first >= to)
+      break;
+    bound += chunk->count;
+  }
+  if (series->nhead > 0 && series->headtimestamps[0] < to &&
+      series->headtimestamps[series->nhead - 1] >= from)
+    bound += series->nhead;
+  return bound;
+}
+
+#ifdef __AVX__
+
+#define BroadcastLastXMM 0xFF // bits 0-7 all set to choose highest element
+
+// zigzag decodes the 4 values of Vec and adds up their prefix sums to the
+// last of Prev
+static inline __m128i _unzigzag_prefix(__m128i Vec, __m128i Prev) {
+  // zigzag: (val >> 1) ^ -(val & 1)
+  Vec = _mm_xor_si128(_mm_srli_epi32(Vec, 1),
+                      _mm_sub_epi32(_mm_setzero_si128(),
+                                    _mm_and_si128(Vec, _mm_set1_epi32(1))));
+  Vec = _mm_add_epi32(Vec, _mm_slli_si128(Vec, 4)); // [A AB BC CD]
+  Vec = _mm_add_epi32(Vec, _mm_slli_si128(Vec, 8)); // [A AB ABC ABCD]
+  return _mm_add_epi32(Vec, _mm_shuffle_epi32(Prev, BroadcastLastXMM));
+}
+
+#endif
+
+// turns the n decoded integers of in (zigzag deltas of deltas) into
+// timestamps
+static void _timestamps(const uint32_t *in, size_t n, uint64_t first,
+                        uint64_t *out) {
+  size_t i = 0;
+  uint32_t delta = 0, offset = 0;
+#ifdef __AVX__
+  __m128i Delta = _mm_setzero_si128();
+  __m128i Offset = _mm_setzero_si128();
+  const __m128i First = _mm_set1_epi64x((long long)first);
+  for (; i + 4 <= n; i += 4) {
+    Delta = _unzigzag_prefix(_mm_loadu_si128((const __m128i *)(in + i)), Delta);
+    __m128i Vec = _mm_add_epi32(Delta, _mm_slli_si128(Delta, 4));
+    Vec = _mm_add_epi32(Vec, _mm_slli_si128(Vec, 8));
+    Offset = _mm_add_epi32(Vec, _mm_shuffle_epi32(Offset, BroadcastLastXMM));
+    _mm_storeu_si128((__m128i *)(out + i),
+                     _mm_add_epi64(_mm_cvtepu32_epi64(Offset), First));
+    _mm_storeu_si128((__m128i *)(out + i + 2),
+                     _mm_add_epi64(_mm_cvtepu32_epi64(_mm_srli_si128(Offset, 8)),
+                                   First));
+  }
+  delta = (uint32_t)_mm_extract_epi32(Delta, 3);
+  offset = (uint32_t)_mm_extract_epi32(Offset, 3);
+#endif
+  for (; i < n; i++) {
+    delta += _unzigzag(in[i]);
+    offset += delta;
+    out[i] = first + offset;
+  }
+}
+
+// turns the n decoded integers of values (zigzag deltas) into values
+static void _values(uint32_t *values, size_t n) {
+  size_t i = 0;
+  uint32_t prev = 0;
+#ifdef __AVX__
+  __m128i Prev = _mm_setzero_si128();
+  for (; i + 4 <= n; i += 4) {
+    Prev = _unzigzag_prefix(_mm_loadu_si128((const __m128i *)(values + i)), Prev);
+    _mm_storeu_si128((__m128i *)(values + i), Prev);
+  }
+  prev = (uint32_t)_mm_extract_epi32(Prev, 3);
+#endif
+  for (; i < n; i++)
+    values[i] = prev += _unzigzag(values[i]);
+}
+
+size_t streamvbyte_series_query(const streamvbyte_series_t *series,
+                                uint64_t from, uint64_t to,
+                                uint64_t *timestamps, uint32_t *values) {
+  size_t written = 0;
+  if (from >= to)
+    return 0;
+  for (size_t i = _first_chunk(series, from); i < series->nchunks; i++) {
+    const svb_series_chunk_t *chunk = _chunk(series, i);
+    if (chunk->first >= to)
+      break;
+    uint64_t *ts = timestamps + written;
+    uint32_t *vals = values + written;
+    const uint8_t *in = series->ring + chunk->offset;
+    // the timestamps are decoded through the values
+    size_t keyLen = chunk->count / 4 + (chunk->count % 4 != 0);
+    in = svb_decode(vals, in, in + keyLen, chunk->count);
+    _timestamps(vals, chunk->count, chunk->first, ts);
+    svb_decode(vals, in, in + keyLen, chunk->count);
+    _values(vals, chunk->count);
+    // only the chunks at the ends of the range may overlap it partly
+    size_t begin = 0, end = chunk->count;
+    if (chunk->first < from)
+      begin = _lower_bound(ts, chunk->count, from);
+    if (chunk->last >= to)
+      end = _lower_bound(ts, chunk->count, to);
+    if (begin > 0) {
+      memmove(ts, ts + begin, (end - begin) * sizeof(uint64_t));
+      memmove(vals, vals + begin, (end - begin) * sizeof(uint32_t));
+    }
+    written += end - begin;
+  }
+  if (series->nhead > 0) {
+    size_t begin = _lower_bound(series->headtimestamps, series->nhead, from);
+    size_t end = _lower_bound(series->headtimestamps, series->nhead, to);
+    if (end > begin) {
+      memcpy(timestamps + written, series->headtimestamps + begin,
+             (end - begin) * sizeof(uint64_t));
+      memcpy(values + written, series->headvalues + begin,
+             (end - begin) * sizeof(uint32_t));
+      written += end - begin;
+    }
+  }
+  return written;
+}
@@ -0,0 +1,370 @@
+#include "streamvbyteset.h"
+#include "streamvbytedelta.h"
+#if defined(_MSC_VER)
+/* Microsoft C/C++-compatible compiler */
+#include <intrin.h>
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+/* GCC-compatible compiler, targeting x86/x86-64 */
+#include <x86intrin.h>
+#endif
+
+#include "streamvbyte_internal.h"
+#include <string.h> // for memcpy, memset
+
+static inline int _ctz(uint64_t w) { // w != 0
+#if defined(__GNUC__)
+  return __builtin_ctzll(w);
+#else
+  int c = 0;
+  while ((w & 1) == 0) {
+    w >>= 1;
+    c++;
+  }
+  return c;
+#endif
+}
+
+enum { SVB_SET_ARRAY, SVB_SET_BITMAP };
+
+#define SVB_SET_ENTRY 12    // bytes per directory entry
+#define SVB_SET_WORDS 1024  // 64-bit words per bitmap
+#define SVB_SET_BLOCK 256   // values per block when streaming an array
+
+typedef struct {
+  uint32_t chunk; // the 16 most significant bits of the values
+  int type;
+  uint32_t cardinality;
+  const uint8_t *payload;
+} svb_container_t;
+
+static inline uint32_t _containers(const uint8_t *set) {
+  uint32_t count;
+  memcpy(&count, set, sizeof(count)); // assumes little endian
+  return count;
+}
+
+static inline svb_container_t _container(const uint8_t *set, uint32_t k) {
+  const uint8_t *entry = set + 4 + (size_t)k * SVB_SET_ENTRY;
+  uint16_t chunk, type;
+  uint32_t offset;
+  svb_container_t c;
+  memcpy(&chunk, entry, sizeof(chunk)); // assumes little endian
+  memcpy(&type, entry + 2, sizeof(type));
+  memcpy(&c.cardinality, entry + 4, sizeof(c.cardinality));
+  memcpy(&offset, entry + 8, sizeof(offset));
+  c.chunk = chunk;
+  c.type = type;
+  c.payload = set + offset;
+  return c;
+}
+
+static inline uint64_t _word(const uint8_t *bitmap, size_t w) {
+  uint64_t word;
+  memcpy(&word, bitmap + 8 * w, sizeof(word)); // assumes little endian
+  return word;
+}
+
+static inline int _bit(const uint8_t *bitmap, uint32_t val) {
+  return (bitmap[(val & 0xFFFF) >> 3] >> (val & 7)) & 1;
+}
+
+// writes the values of the word w of the chunk whose set bits are in word
+static inline uint32_t *_extract(uint64_t word, uint32_t base, uint32_t *out) {
+  while (word != 0) {
+    *out++ = base + _ctz(word);
+    word &= word - 1;
+  }
+  return out;
+}
+
+static inline uint32_t _base(const svb_container_t *c) {
+  return c->chunk << 16;
+}
+
+/* streaming the values of an array container, a block at a time */
+
+typedef struct {
+  const uint8_t *keyPtr;
+  const uint8_t *dataPtr;
+  size_t remaining; // values not decoded yet
+  uint32_t prev;
+  uint32_t *values; // the current block
+  size_t length;    // number of values of the current block
+} svb_set_reader_t;
+
+static inline void _reader_init(svb_set_reader_t *r, const svb_container_t *c,
+                                uint32_t *block) {
+  r->keyPtr = c->payload;
+  r->dataPtr = c->payload + (c->cardinality + 3) / 4;
+  r->remaining = c->cardinality;
+  r->prev = _base(c);
+  r->values = block;
+  r->length = 0;
+}
+
+// decodes the next block, returns 0 when the array is over
+static inline int _reader_refill(svb_set_reader_t *r) {
+  size_t n = r->remaining < SVB_SET_BLOCK ? r->remaining : SVB_SET_BLOCK;
+  if (n == 0)
+    return 0;
+  r->dataPtr = svb_decode_d1(r->values, r->keyPtr, r->dataPtr, n, r->prev);
+  r->keyPtr += n / 4; // all blocks but the last hold multiples of 4 values
+  r->prev = r->values[n - 1];
+  r->remaining -= n;
+  r->length = n;
+  return 1;
+}
+
+/* encoding */
+
+size_t streamvbyte_set_encode(const uint32_t *in, uint32_t length, uint8_t *out) {
+  uint32_t containers = 0;
+  for (uint32_t i = 0; i < length; i++)
+    if (i == 0 || (in[i] >> 16) != (in[i - 1] >> 16))
+      containers++;
+  memcpy(out, &containers, sizeof(containers)); // assumes little endian
+  uint8_t *entry = out + 4;
+  uint8_t *p = entry + (size_t)containers * SVB_SET_ENTRY;
+  for (uint32_t i = 0; i < length;) {
+    uint32_t chunk = in[i] >> 16, n = 1;
+    while (i + n < length && (in[i + n] >> 16) == chunk)
+      n++;
+    uint16_t key = (uint16_t)chunk, type = SVB_SET_ARRAY;
+    uint32_t offset = (uint32_t)(p - out);
+    // differences from chunk << 16: the first one is the low 16 bits
+    if (streamvbyte_delta_compressedbytes64(in + i, n, chunk << 16) <
+        STREAMVBYTE_SET_BITMAP_BYTES) {
+      p = svb_encode_d1(in + i, p, p + (n + 3) / 4, n, chunk << 16);
+    } else {
+      type = SVB_SET_BITMAP;
+      memset(p, 0, STREAMVBYTE_SET_BITMAP_BYTES);
+      for (uint32_t k = i; k < i + n; k++)
+        p[(in[k] & 0xFFFF) >> 3] |= (uint8_t)(1 << (in[k] & 7));
+      p += STREAMVBYTE_SET_BITMAP_BYTES;
+    }
+    memcpy(entry, &key, sizeof(key)); // assumes little endian
+    memcpy(entry + 2, &type, sizeof(type));
+    memcpy(entry + 4, &n, sizeof(n));
+    memcpy(entry + 8, &offset, sizeof(offset));
+    entry += SVB_SET_ENTRY;
+    i += n;
+  }
+  return p - out;
+}
+
+/* decoding */
+
+size_t streamvbyte_set_cardinality(const uint8_t *in) {
+  size_t cardinality = 0;
+  uint32_t containers = _containers(in);
+  for (uint32_t k = 0; k < containers; k++)
+    cardinality += _container(in, k).cardinality;
+  return cardinality;
+}
+
+// writes the values of the container c to out, returns the end of out
+static uint32_t *_decode_container(const svb_container_t *c, uint32_t *out) {
+  if (c->type == SVB_SET_ARRAY) {
+    svb_decode_d1(out, c->payload, c->payload + (c->cardinality + 3) / 4,
+                  c->cardinality, _base(c));
+    return out + c->cardinality;
+  }
+  for (size_t w = 0; w < SVB_SET_WORDS; w++)
+    out = _extract(_word(c->payload, w), _base(c) + 64 * w, out);
+  return out;
+}
+
+size_t streamvbyte_set_decode(const uint8_t *in, uint32_t *out) {
+  uint32_t *start = out;
+  uint32_t containers = _containers(in);
+  for (uint32_t k = 0; k < containers; k++) {
+    svb_container_t c = _container(in, k);
+    out = _decode_container(&c, out);
+  }
+  return out - start;
+}
+
+// index of the container of chunk in the set, -1 if there is none
+static long _find(const uint8_t *set, uint32_t chunk) {
+  long lo = 0, hi = (long)_containers(set) - 1;
+  while (lo <= hi) {
+    long mid = lo + (hi - lo) / 2;
+    uint32_t c = _container(set, (uint32_t)mid).chunk;
+    if (c == chunk)
+      return mid;
+    if (c < chunk)
+      lo = mid + 1;
+    else
+      hi = mid - 1;
+  }
+  return -1;
+}
+
+int streamvbyte_set_contains(const uint8_t *in, uint32_t value) {
+  long k = _find(in, value >> 16);
+  if (k < 0)
+    return 0;
+  svb_container_t c = _container(in, (uint32_t)k);
+  if (c.type == SVB_SET_BITMAP)
+    return _bit(c.payload, value);
+  uint32_t block[SVB_SET_BLOCK];
+  svb_set_reader_t r;
+  _reader_init(&r, &c, block);
+  while (_reader_refill(&r)) {
+    if (r.values[r.length - 1] < value)
+      continue; // the values are increasing
+    for (size_t i = 0; i < r.length; i++)
+      if (r.values[i] >= value)
+        return r.values[i] == value;
+  }
+  return 0;
+}
+
+/* intersection */
+
+// Intersects the containers a and b (of the same chunk) to out, which has
+// room for the values of the array (of a if both are arrays), returns the end
+// of the result.
+static uint32_t *_intersect(const svb_container_t *a, const svb_container_t *b,
+                            uint32_t *out) {
+  if (a->type == SVB_SET_BITMAP && b->type == SVB_SET_BITMAP) {
+    for (size_t w = 0; w < SVB_SET_WORDS; w++)
+      out = _extract(_word(a->payload, w) & _word(b->payload, w),
+                     _base(a) + 64 * w, out);
+    return out;
+  }
+  if (a->type == SVB_SET_BITMAP) {
+    const svb_container_t *t = a;
+    a = b;
+    b = t;
+  }
+  // a is an array: decoded to out, then filtered in place
+  uint32_t *end = _decode_container(a, out);
+  uint32_t *result = out;
+  if (b->type == SVB_SET_BITMAP) {
+    for (uint32_t *v = out; v < end; v++) {
+      *result = *v;
+      result += _bit(b->payload, *v);
+    }
+    return result;
+  }
+  // both are arrays: b is streamed against the values of a (result never
+  // goes past the value of a being compared)
+  uint32_t block[SVB_SET_BLOCK];
+  svb_set_reader_t r;
+  _reader_init(&r, b, block);
+  uint32_t *v = out;
+  while (v < end && _reader_refill(&r)) {
+    for (size_t i = 0; i < r.length && v < end;) {
+      uint32_t x = r.values[i];
+      if (*v < x) {
+        v++;
+      } else if (*v > x) {
+        i++;
+      } else {
+        *result++ = x;
+        v++;
+        i++;
+      }
+    }
+  }
+  return result;
+}
+
+size_t streamvbyte_set_intersect(const uint8_t *a, const uint8_t *b, uint32_t *out) {
+  uint32_t *start = out;
+  uint32_t na = _containers(a), nb = _containers(b);
+  for (uint32_t i = 0, j = 0; i < na && j < nb;) {
+    svb_container_t ca = _container(a, i), cb = _container(b, j);
+    if (ca.chunk < cb.chunk) {
+      i++;
+    } else if (ca.chunk > cb.chunk) {
+      j++;
+    } else {
+      // decode the array with fewer values, as scratch space
+      if (ca.type == cb.type && cb.cardinality < ca.cardinality)
+        out = _intersect(&cb, &ca, out);
+      else
+        out = _intersect(&ca, &cb, out);
+      i++;
+      j++;
+    }
+  }
+  return out - start;
+}
+
+/* union */
+
+// Unites the containers a and b (of the same chunk) to out, which has room
+// for the cardinalities of both, returns the end of the result.
+static uint32_t *_unite(const svb_container_t *a, const svb_container_t *b,
+                        uint32_t *out) {
+  if (a->type == SVB_SET_BITMAP && b->type == SVB_SET_BITMAP) {
+    for (size_t w = 0; w < SVB_SET_WORDS; w++)
+      out = _extract(_word(a->payload, w) | _word(b->payload, w),
+                     _base(a) + 64 * w, out);
+    return out;
+  }
+  if (a->type == SVB_SET_BITMAP) {
+    const svb_container_t *t = a;
+    a = b;
+    b = t;
+  }
+  uint32_t block[SVB_SET_BLOCK];
+  svb_set_reader_t r;
+  _reader_init(&r, a, block);
+  if (b->type == SVB_SET_BITMAP) {
+    // the values of the array a are set in a copy of the bitmap b
+    uint64_t bits[SVB_SET_WORDS];
+    memcpy(bits, b->payload, sizeof(bits));
+    while (_reader_refill(&r))
+      for (size_t i = 0; i < r.length; i++)
+        bits[(r.values[i] & 0xFFFF) / 64] |= UINT64_C(1) << (r.values[i] % 64);
+    for (size_t w = 0; w < SVB_SET_WORDS; w++)
+      out = _extract(bits[w], _base(a) + 64 * w, out);
+    return out;
+  }
+  // both are arrays: b is decoded past the room needed by a, and a is
+  // streamed and merged with it (the result never catches up with the value
+  // of b being compared)
+  uint32_t *v = _decode_container(b, out + a->cardinality) - b->cardinality;
+  uint32_t *end = v + b->cardinality;
+  while (_reader_refill(&r)) {
+    for (size_t i = 0; i < r.length; i++) {
+      uint32_t x = r.values[i];
+      while (v < end && *v < x)
+        *out++ = *v++;
+      if (v < end && *v == x)
+        v++;
+      *out++ = x;
+    }
+  }
+  while (v < end)
+    *out++ = *v++;
+  return out;
+}
+
+size_t streamvbyte_set_union(const uint8_t *a, const uint8_t *b, uint32_t *out) {
+  uint32_t *start = out;
+  uint32_t na = _containers(a), nb = _containers(b);
+  uint32_t i = 0, j = 0;
+  while (i < na || j < nb) {
+    svb_container_t ca, cb;
+    if (i < na)
+      ca = _container(a, i);
+    if (j < nb)
+      cb = _container(b, j);
+    if (j == nb || (i < na && ca.chunk < cb.chunk)) {
+      out = _decode_container(&ca, out);
+      i++;
+    } else if (i == na || cb.chunk < ca.chunk) {
+      out = _decode_container(&cb, out);
+      j++;
+    } else {
+      out = _unite(&ca, &cb, out);
+      i++;
+      j++;
+    }
+  }
+  return out - start;
+}
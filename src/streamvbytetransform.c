@@ -0,0 +1,237 @@
+#include "streamvbytetransform.h"
+#include "streamvbyte.h"
+#if defined(_MSC_VER)
+/* Microsoft C/C++-compatible compiler */
+#include <intrin.h>
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+/* GCC-compatible compiler, targeting x86/x86-64 */
+#include <x86intrin.h>
+#endif
+
+#ifdef __AVX__
+
+#include "streamvbyte_shuffle_tables.h"
+
+#endif
+
+#include "streamvbyte_internal.h"
+#include <string.h> // for memcpy
+
+#define SVB_TRANSFORMS 4
+
+static inline uint32_t _zigzag(uint32_t val) {
+  return (val << 1) ^ (0 - (val >> 31));
+}
+
+static inline uint32_t _unzigzag(uint32_t val) {
+  return (val >> 1) ^ (0 - (val & 1));
+}
+
+static inline uint32_t _forward(uint32_t val, uint32_t prev, int transform) {
+  switch (transform) {
+  case STREAMVBYTE_TRANSFORM_DELTA:
+    return val - prev;
+  case STREAMVBYTE_TRANSFORM_ZIGZAG_DELTA:
+    return _zigzag(val - prev);
+  case STREAMVBYTE_TRANSFORM_XOR:
+    return val ^ prev;
+  default:
+    return val;
+  }
+}
+
+static inline uint32_t _inverse(uint32_t val, uint32_t prev, int transform) {
+  switch (transform) {
+  case STREAMVBYTE_TRANSFORM_DELTA:
+    return prev + val;
+  case STREAMVBYTE_TRANSFORM_ZIGZAG_DELTA:
+    return prev + _unzigzag(val);
+  case STREAMVBYTE_TRANSFORM_XOR:
+    return prev ^ val;
+  default:
+    return val;
+  }
+}
+
+// writes the transform of the count values of in to out, the value before
+// the first one being prev
+static inline void _forward_block(uint32_t *out, const uint32_t *in,
+                                  size_t count, uint32_t prev, int transform) {
+  out[0] = _forward(in[0], prev, transform);
+  for (size_t c = 1; c < count; c++)
+    out[c] = _forward(in[c], in[c - 1], transform);
+}
+
+static void _transform_block(uint32_t *out, const uint32_t *in, size_t count,
+                             uint32_t prev, int transform) {
+  // one copy of the loop per transform
+  switch (transform) {
+  case STREAMVBYTE_TRANSFORM_DELTA:
+    _forward_block(out, in, count, prev, STREAMVBYTE_TRANSFORM_DELTA);
+    break;
+  case STREAMVBYTE_TRANSFORM_ZIGZAG_DELTA:
+    _forward_block(out, in, count, prev, STREAMVBYTE_TRANSFORM_ZIGZAG_DELTA);
+    break;
+  default:
+    _forward_block(out, in, count, prev, STREAMVBYTE_TRANSFORM_XOR);
+  }
+}
+
+size_t streamvbyte_transform_encode(const uint32_t *in, uint32_t length,
+                                    uint8_t *out) {
+  uint32_t transformed[SVB_TRANSFORMS][STREAMVBYTE_TRANSFORM_BLOCK];
+  uint8_t *p = out;
+  uint32_t prev = 0;
+  // row is a size_t so that row + STREAMVBYTE_TRANSFORM_BLOCK cannot wrap
+  for (size_t row = 0; row < length; row += STREAMVBYTE_TRANSFORM_BLOCK) {
+    uint32_t count = (uint32_t)(length - row);
+    if (count > STREAMVBYTE_TRANSFORM_BLOCK)
+      count = STREAMVBYTE_TRANSFORM_BLOCK;
+    const uint32_t *block = in + row;
+
+    // the block is kept with the transform giving the smallest encoding, as
+    // measured by the encoder; ties go to the transform that is the cheapest
+    // to decode
+    const uint32_t *values = block;
+    int transform = STREAMVBYTE_TRANSFORM_NONE;
+    size_t bytes = streamvbyte_compressedbytes64(block, count);
+    for (int t = 1; t < SVB_TRANSFORMS; t++) {
+      _transform_block(transformed[t], block, count, prev, t);
+      size_t tbytes = streamvbyte_compressedbytes64(transformed[t], count);
+      if (tbytes < bytes) {
+        bytes = tbytes;
+        values = transformed[t];
+        transform = t;
+      }
+    }
+    prev = block[count - 1];
+
+    *p++ = (uint8_t)transform;
+    uint8_t *keyPtr = p;
+    size_t keyLen = count / 4 + (count % 4 != 0); // 2-bits rounded to full byte
+    p = svb_encode(values, keyPtr, keyPtr + keyLen, count);
+  }
+  return p - out;
+}
+
+#ifdef __AVX__
+
+#define BroadcastLastXMM 0xFF // bits 0-7 all set to choose highest element
+
+// undoes the transform of the 4 decoded values in Vec, given the previous
+// values in Prev
+static inline __m128i _inverse_avx(__m128i Vec, __m128i Prev, int transform) {
+  if (transform == STREAMVBYTE_TRANSFORM_NONE)
+    return Vec;
+  Prev = _mm_shuffle_epi32(Prev, BroadcastLastXMM); // [P P P P]
+  if (transform == STREAMVBYTE_TRANSFORM_XOR) {
+    Vec = _mm_xor_si128(Vec, _mm_slli_si128(Vec, 4)); // [A AB BC CD]
+    Vec = _mm_xor_si128(Vec, _mm_slli_si128(Vec, 8)); // [A AB ABC ABCD]
+    return _mm_xor_si128(Vec, Prev);
+  }
+  if (transform == STREAMVBYTE_TRANSFORM_ZIGZAG_DELTA) {
+    // zigzag: (val >> 1) ^ -(val & 1)
+    Vec = _mm_xor_si128(_mm_srli_epi32(Vec, 1),
+                        _mm_sub_epi32(_mm_setzero_si128(),
+                                      _mm_and_si128(Vec, _mm_set1_epi32(1))));
+  }
+  Vec = _mm_add_epi32(Vec, _mm_slli_si128(Vec, 4)); // [A AB BC CD]
+  Vec = _mm_add_epi32(Vec, _mm_slli_si128(Vec, 8)); // [A AB ABC ABCD]
+  return _mm_add_epi32(Vec, Prev);
+}
+
+// decodes and undoes the transform of the first nquads quads with 16-byte
+// loads
+static inline const uint8_t *
+_decode_avx_transform(uint32_t *out, const uint8_t *keyPtr,
+                      const uint8_t *dataPtr, size_t nquads, uint32_t *prev,
+                      int transform) {
+  __m128i Prev = _mm_set1_epi32(*prev);
+  for (size_t q = 0; q < nquads; q++) {
+    uint8_t key = keyPtr[q];
+    __m128i Data = _mm_loadu_si128((__m128i *)dataPtr);
+    __m128i Shuf = _mm_loadu_si128((__m128i *)shuffleTable[key]);
+    Prev = _inverse_avx(_mm_shuffle_epi8(Data, Shuf), Prev, transform);
+    _mm_storeu_si128((__m128i *)(out + 4 * q), Prev);
+    dataPtr += lengthTable[key];
+  }
+  if (nquads > 0)
+    *prev = (uint32_t)_mm_extract_epi32(Prev, 3);
+  return dataPtr;
+}
+
+#endif
+
+// Decodes a block and undoes its transform, the block being followed in the
+// stream by at least "after" bytes. A 16-byte load is safe when 12 more bytes
+// follow the quad loaded: at least count - 4 * (q + 1) + after bytes follow
+// quad q, since every value takes at least a byte. The quads past the safe
+// ones are decoded without vector loads.
+static const uint8_t *_decode_transform(uint32_t *out, const uint8_t *keyPtr,
+                                        const uint8_t *dataPtr, size_t count,
+                                        uint32_t *prev, int transform,
+                                        size_t after) {
+  size_t nquads = count / 4;
+  if (count + after < 12)
+    nquads = 0;
+  else if ((count + after - 12) / 4 < nquads)
+    nquads = (count + after - 12) / 4;
+  size_t c = 4 * nquads;
+#ifdef __AVX__
+  // one copy of the loop per transform
+  switch (transform) {
+  case STREAMVBYTE_TRANSFORM_NONE:
+    dataPtr = _decode_avx_transform(out, keyPtr, dataPtr, nquads, prev,
+                                    STREAMVBYTE_TRANSFORM_NONE);
+    break;
+  case STREAMVBYTE_TRANSFORM_DELTA:
+    dataPtr = _decode_avx_transform(out, keyPtr, dataPtr, nquads, prev,
+                                    STREAMVBYTE_TRANSFORM_DELTA);
+    break;
+  case STREAMVBYTE_TRANSFORM_XOR:
+    dataPtr = _decode_avx_transform(out, keyPtr, dataPtr, nquads, prev,
+                                    STREAMVBYTE_TRANSFORM_XOR);
+    break;
+  default:
+    dataPtr = _decode_avx_transform(out, keyPtr, dataPtr, nquads, prev,
+                                    STREAMVBYTE_TRANSFORM_ZIGZAG_DELTA);
+  }
+  size_t first = c; // the first value whose transform is left to undo
+#else
+  dataPtr = svb_decode(out, keyPtr, dataPtr, c);
+  size_t first = 0;
+#endif
+  dataPtr = svb_decode_scalar(out + c, keyPtr + c / 4, dataPtr, count - c);
+  uint32_t p = *prev;
+  for (c = first; c < count; c++)
+    out[c] = p = _inverse(out[c], p, transform);
+  *prev = p;
+  return dataPtr;
+}
+
+size_t streamvbyte_transform_decode(const uint8_t *in, uint32_t *out,
+                                    uint32_t length) {
+  const uint8_t *p = in;
+  uint32_t prev = 0;
+  // row is a size_t so that row + STREAMVBYTE_TRANSFORM_BLOCK cannot wrap
+  for (size_t row = 0; row < length; row += STREAMVBYTE_TRANSFORM_BLOCK) {
+    uint32_t count = (uint32_t)(length - row);
+    if (count > STREAMVBYTE_TRANSFORM_BLOCK)
+      count = STREAMVBYTE_TRANSFORM_BLOCK;
+    int transform = *p++;
+    const uint8_t *keyPtr = p;
+    uint32_t keyLen = (count + 3) / 4; // 2-bits per key (rounded up)
+    // the values of the following blocks take at least a byte each, and the
+    // regular decoders may read up to 12 bytes past the block
+    size_t after = length - row - count;
+    if (after >= 12 && transform == STREAMVBYTE_TRANSFORM_NONE)
+      p = svb_decode(out + row, keyPtr, keyPtr + keyLen, count);
+    else if (after >= 12 && transform == STREAMVBYTE_TRANSFORM_DELTA)
+      p = svb_decode_d1(out + row, keyPtr, keyPtr + keyLen, count, prev);
+    else
+      p = _decode_transform(out + row, keyPtr, keyPtr + keyLen, count, &prev,
+                            transform, after);
+    prev = out[row + count - 1];
+  }
+  return p - in;
+}
@@ -0,0 +1,157 @@
+#include "streamvbyteupdatable.h"
+#include "streamvbyte.h"
+
+#include "streamvbyte_internal.h"
+#include <string.h> // for memcpy, memmove
+
+// number of values in block b
+static inline uint32_t _block_count(uint32_t length, size_t b) {
+  size_t row = b * STREAMVBYTE_UPDATABLE_BLOCK;
+  return length - row < STREAMVBYTE_UPDATABLE_BLOCK
+             ? (uint32_t)(length - row)
+             : STREAMVBYTE_UPDATABLE_BLOCK;
+}
+
+// largest possible size of a block of count values
+static inline uint32_t _block_max_size(uint32_t count) {
+  return (count + 3) / 4 + count * sizeof(uint32_t);
+}
+
+static inline uint8_t _code(uint32_t val) {
+  if (val < (1 << 8))
+    return 0;
+  if (val < (1 << 16))
+    return 1;
+  if (val < (1 << 24))
+    return 2;
+  return 3;
+}
+
+// number of data bytes described by a whole control byte
+static inline size_t _key_length(uint8_t key) {
+  return 4 + (key & 3) + ((key >> 2) & 3) + ((key >> 4) & 3) + (key >> 6);
+}
+
+// offset, within the data bytes of a block, of the value at position i
+static size_t _data_offset(const uint8_t *keys, uint32_t i) {
+  size_t offset = 0;
+  for (uint32_t k = 0; k < i / 4; k++)
+    offset += _key_length(keys[k]);
+  uint8_t key = keys[i / 4];
+  for (uint32_t j = 0; j < i % 4; j++)
+    offset += ((key >> (2 * j)) & 3) + 1;
+  return offset;
+}
+
+size_t streamvbyte_updatable_encode(const uint32_t *in, uint32_t length, uint32_t slack,
+                                    uint8_t *out, streamvbyte_slot_t *slots) {
+  size_t used = 0;
+  size_t nslots = streamvbyte_updatable_slots(length);
+  for (size_t b = 0; b < nslots; b++) {
+    uint32_t count = _block_count(length, b);
+    uint8_t *keyPtr = out + used;
+    size_t size = svb_encode(in + b * STREAMVBYTE_UPDATABLE_BLOCK, keyPtr,
+                             keyPtr + (count + 3) / 4, count) -
+                  keyPtr;
+    size_t capacity = size + slack;
+    if (capacity > _block_max_size(count))
+      capacity = _block_max_size(count);
+    slots[b].offset = (uint32_t)used;
+    slots[b].size = (uint16_t)size;
+    slots[b].capacity = (uint16_t)capacity;
+    used += capacity;
+  }
+  return used;
+}
+
+uint32_t streamvbyte_updatable_get(const uint8_t *in, const streamvbyte_slot_t *slots,
+                                   uint32_t length, uint32_t index) {
+  size_t b = index / STREAMVBYTE_UPDATABLE_BLOCK;
+  uint32_t i = index % STREAMVBYTE_UPDATABLE_BLOCK;
+  uint32_t count = _block_count(length, b);
+  const uint8_t *keys = in + slots[b].offset;
+  const uint8_t *data = keys + (count + 3) / 4 + _data_offset(keys, i);
+  uint32_t val = 0;
+  memcpy(&val, data, ((keys[i / 4] >> (2 * (i % 4))) & 3) + 1); // assumes little endian
+  return val;
+}
+
+int streamvbyte_updatable_set(uint8_t *buf, size_t *used, size_t capacity,
+                              streamvbyte_slot_t *slots, uint32_t length,
+                              uint32_t index, uint32_t value) {
+  size_t b = index / STREAMVBYTE_UPDATABLE_BLOCK;
+  uint32_t i = index % STREAMVBYTE_UPDATABLE_BLOCK;
+  uint32_t count = _block_count(length, b);
+  streamvbyte_slot_t *slot = &slots[b];
+  uint8_t *keys = buf + slot->offset;
+  size_t keyLen = (count + 3) / 4;
+  size_t offset = keyLen + _data_offset(keys, i);
+  uint8_t shift = 2 * (i % 4);
+  uint8_t oldcode = (keys[i / 4] >> shift) & 3;
+  uint8_t newcode = _code(value);
+
+  if (newcode == oldcode) {
+    // same width: patch the data bytes
+    memcpy(keys + offset, &value, newcode + 1); // assumes little endian
+    return 0;
+  }
+
+  // the bytes following the value within the block
+  size_t tail = offset + oldcode + 1;
+  size_t tailLen = slot->size - tail;
+  size_t newsize = slot->size + newcode - oldcode;
+  uint8_t newkey = (uint8_t)((keys[i / 4] & ~(3 << shift)) | (newcode << shift));
+
+  if (newsize <= slot->capacity) {
+    // the block still fits in its slot: shift the tail
+    memmove(keys + offset + newcode + 1, keys + tail, tailLen);
+  } else {
+    // move the block to a new slot that can hold any content
+    size_t newcapacity = _block_max_size(count);
+    if (*used + newcapacity > capacity)
+      return -1;
+    uint8_t *moved = buf + *used;
+    memcpy(moved, keys, offset);
+    memcpy(moved + offset + newcode + 1, keys + tail, tailLen);
+    slot->offset = (uint32_t)*used;
+    slot->capacity = (uint16_t)newcapacity;
+    *used += newcapacity;
+    keys = moved;
+  }
+  memcpy(keys + offset, &value, newcode + 1); // assumes little endian
+  keys[i / 4] = newkey;
+  slot->size = (uint16_t)newsize;
+  return 0;
+}
+
+size_t streamvbyte_updatable_compact(const uint8_t *in, streamvbyte_slot_t *slots,
+                                     uint32_t length, uint32_t slack, uint8_t *out) {
+  size_t used = 0;
+  size_t nslots = streamvbyte_updatable_slots(length);
+  for (size_t b = 0; b < nslots; b++) {
+    uint32_t count = _block_count(length, b);
+    size_t size = slots[b].size;
+    size_t capacity = size + slack;
+    if (capacity > _block_max_size(count))
+      capacity = _block_max_size(count);
+    memcpy(out + used, in + slots[b].offset, size);
+    slots[b].offset = (uint32_t)used;
+    slots[b].capacity = (uint16_t)capacity;
+    used += capacity;
+  }
+  return used;
+}
+
+size_t streamvbyte_updatable_decode(const uint8_t *in, const streamvbyte_slot_t *slots,
+                                    uint32_t *out, uint32_t length) {
+  size_t read = 0;
+  size_t nslots = streamvbyte_updatable_slots(length);
+  for (size_t b = 0; b < nslots; b++) {
+    uint32_t count = _block_count(length, b);
+    const uint8_t *keyPtr = in + slots[b].offset;
+    read += svb_decode(out + b * STREAMVBYTE_UPDATABLE_BLOCK, keyPtr,
+                       keyPtr + (count + 3) / 4, count) -
+            keyPtr;
+  }
+  return read;
+}
@@ -0,0 +1,57 @@
+// Checks the single-header version of the library: run ./amalgamation.sh
+// first (see "make amalgamation_demo").
+#define STREAMVBYTE_STATIC
+#include "streamvbyte_amalgamated.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// with a constant count, the compiler specializes the inlined decoder
+static size_t decode16(const uint8_t *in, uint32_t *out) {
+  return streamvbyte_decode(in, out, 16);
+}
+
+static size_t delta_decode32(const uint8_t *in, uint32_t *out) {
+  return streamvbyte_delta_decode(in, out, 32, 0);
+}
+
+int main() {
+  int N = 4096;
+  uint32_t *datain = malloc(N * sizeof(uint32_t));
+  uint32_t *recovdata = malloc(N * sizeof(uint32_t));
+  uint8_t *compressedbuffer = malloc(streamvbyte_max_compressedbytes(N));
+  for (int length = 0; length <= N;) {
+    for (int delta = 0; delta <= 1; ++delta) {
+      uint32_t prev = 0;
+      for (int k = 0; k < length; ++k)
+        datain[k] = delta ? (prev += (uint32_t)rand() >> (31 & rand()))
+                          : (uint32_t)rand() >> (31 & rand());
+      size_t compsize =
+          delta ? streamvbyte_delta_encode(datain, length, compressedbuffer, 0)
+                : streamvbyte_encode(datain, length, compressedbuffer);
+      size_t usedbytes =
+          delta ? streamvbyte_delta_decode(compressedbuffer, recovdata, length, 0)
+                : streamvbyte_decode(compressedbuffer, recovdata, length);
+      if (length == 16 && !delta)
+        usedbytes = decode16(compressedbuffer, recovdata);
+      if (length == 32 && delta)
+        usedbytes = delta_decode32(compressedbuffer, recovdata);
+      if (compsize != usedbytes ||
+          memcmp(datain, recovdata, length * sizeof(uint32_t)) != 0) {
+        printf("[amalgamation_demo] code is buggy length = %d delta = %d\n",
+               length, delta);
+        return -1;
+      }
+    }
+    if (length < 300)
+      ++length;
+    else
+      length *= 2;
+  }
+  free(datain);
+  free(recovdata);
+  free(compressedbuffer);
+  printf("The amalgamated header looks good.\n");
+  return 0;
+}
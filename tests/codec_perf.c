@@ -0,0 +1,237 @@
+// Compares StreamVByte against self-contained reference codecs (memcpy,
+// LEB128 varint, Group Varint and contrib/short_varint.c) on the same data.
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "streamvbyte.h"
+
+#if defined(__SSSE3__)
+#include "../contrib/short_varint.c"
+#endif
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1000000000.0;
+}
+
+/* memcpy: the bandwidth every codec is compared to */
+
+static size_t memcpy_encode(const uint32_t *in, size_t count, uint8_t *out) {
+  memcpy(out, in, count * sizeof(uint32_t));
+  return count * sizeof(uint32_t);
+}
+
+static size_t memcpy_decode(const uint8_t *in, uint32_t *out, size_t count) {
+  memcpy(out, in, count * sizeof(uint32_t));
+  return count * sizeof(uint32_t);
+}
+
+/* LEB128: 7 data bits per byte, the most significant bit flags continuation */
+
+static size_t varint_encode(const uint32_t *in, size_t count, uint8_t *out) {
+  uint8_t *p = out;
+  for (size_t i = 0; i < count; i++) {
+    uint32_t val = in[i];
+    while (val >= 0x80) {
+      *p++ = (uint8_t)(val | 0x80);
+      val >>= 7;
+    }
+    *p++ = (uint8_t)val;
+  }
+  return p - out;
+}
+
+static size_t varint_decode(const uint8_t *in, uint32_t *out, size_t count) {
+  const uint8_t *p = in;
+  for (size_t i = 0; i < count; i++) {
+    uint32_t val = *p & 0x7F;
+    for (int shift = 7; *p++ & 0x80; shift += 7)
+      val |= (uint32_t)(*p & 0x7F) << shift;
+    out[i] = val;
+  }
+  return p - in;
+}
+
+/* Group Varint: one key byte (four 2-bit lengths) followed by the data bytes
+   of four values, the layout that StreamVByte splits into two streams */
+
+static size_t groupvarint_encode(const uint32_t *in, size_t count,
+                                 uint8_t *out) {
+  uint8_t *p = out;
+  for (size_t i = 0; i < count; i += 4) {
+    uint8_t *keyPtr = p++;
+    uint8_t key = 0;
+    for (size_t j = 0; j < 4 && i + j < count; j++) {
+      uint32_t val = in[i + j];
+      uint8_t code = val < (1 << 8) ? 0 : val < (1 << 16) ? 1
+                                        : val < (1 << 24) ? 2 : 3;
+      memcpy(p, &val, sizeof(uint32_t)); // assumes little endian
+      p += code + 1;
+      key |= code << (2 * j);
+    }
+    *keyPtr = key;
+  }
+  return p - out;
+}
+
+static size_t groupvarint_decode(const uint8_t *in, uint32_t *out,
+                                 size_t count) {
+  static const uint32_t mask[4] = {0xFF, 0xFFFF, 0xFFFFFF, 0xFFFFFFFF};
+  const uint8_t *p = in;
+  for (size_t i = 0; i < count; i += 4) {
+    uint8_t key = *p++;
+    for (size_t j = 0; j < 4 && i + j < count; j++) {
+      uint32_t code = (key >> (2 * j)) & 3;
+      uint32_t val;
+      memcpy(&val, p, sizeof(uint32_t)); // reads up to 3 bytes past the value
+      out[i + j] = val & mask[code];
+      p += code + 1;
+    }
+  }
+  return p - in;
+}
+
+/* StreamVByte */
+
+static size_t svb_encode_all(const uint32_t *in, size_t count, uint8_t *out) {
+  return streamvbyte_encode((uint32_t *)in, (uint32_t)count, out);
+}
+
+static size_t svb_decode_all(const uint8_t *in, uint32_t *out, size_t count) {
+  return streamvbyte_decode(in, out, (uint32_t)count);
+}
+
+#if defined(__SSSE3__)
+
+/* contrib/short_varint.c: only applies to 16-bit values, the values are
+   narrowed before encoding and widened after decoding (outside the timings) */
+
+static uint16_t *shortin;
+static uint16_t *shortout;
+
+static size_t short_encode(const uint32_t *in, size_t count, uint8_t *out) {
+  (void)in;
+  return short_enc(out, shortin, count) - out;
+}
+
+static size_t short_decode(const uint8_t *in, uint32_t *out, size_t count) {
+  (void)out;
+  return short_dec(shortout, in, count) - in;
+}
+
+#endif
+
+typedef struct {
+  const char *name;
+  size_t (*encode)(const uint32_t *in, size_t count, uint8_t *out);
+  size_t (*decode)(const uint8_t *in, uint32_t *out, size_t count);
+  int sixteenbits; // only valid for values smaller than 1 << 16
+} codec_t;
+
+static const codec_t codecs[] = {
+    {"memcpy", memcpy_encode, memcpy_decode, 0},
+    {"varint", varint_encode, varint_decode, 0},
+    {"groupvarint", groupvarint_encode, groupvarint_decode, 0},
+    {"streamvbyte", svb_encode_all, svb_decode_all, 0},
+#if defined(__SSSE3__)
+    {"short_varint", short_encode, short_decode, 1},
+#endif
+};
+
+typedef struct {
+  const char *name;
+  uint32_t (*next)(void);
+  int sixteenbits; // all values are smaller than 1 << 16
+} distribution_t;
+
+static uint32_t uniform8(void) { return rand() & 0xFF; }
+static uint32_t uniform16(void) { return rand() & 0xFFFF; }
+static uint32_t skewed(void) { return rand() >> (31 & rand()); }
+static uint32_t uniform32(void) { return (uint32_t)rand() << 16 ^ rand(); }
+
+static const distribution_t distributions[] = {
+    {"uniform8", uniform8, 1},
+    {"uniform16", uniform16, 1},
+    {"skewed", skewed, 0},
+    {"uniform32", uniform32, 0},
+};
+
+int main() {
+  size_t N = 1000000;
+  int NTrials = 20;
+  uint32_t *datain = malloc(N * sizeof(uint32_t));
+  uint32_t *recovdata = malloc(N * sizeof(uint32_t));
+  // the largest output is memcpy or varint (5 bytes per value), plus slack
+  uint8_t *compressedbuffer = malloc(N * 5 + 16);
+#if defined(__SSSE3__)
+  shortin = malloc(N * sizeof(uint16_t));
+  shortout = malloc(N * sizeof(uint16_t));
+#endif
+  const size_t ncodecs = sizeof(codecs) / sizeof(codecs[0]);
+  const size_t ndistributions = sizeof(distributions) / sizeof(distributions[0]);
+
+  printf("%-12s %-12s %8s %8s %12s %12s %10s %8s\n", "distribution", "codec",
+         "bits/int", "ratio", "enc Mint/s", "dec Mint/s", "dec GB/s",
+         "%memcpy");
+  for (size_t d = 0; d < ndistributions; d++) {
+    srand(1234);
+    for (size_t k = 0; k < N; ++k)
+      datain[k] = distributions[d].next();
+#if defined(__SSSE3__)
+    for (size_t k = 0; k < N; ++k)
+      shortin[k] = (uint16_t)datain[k];
+#endif
+    double memcpybandwidth = 0;
+    for (size_t c = 0; c < ncodecs; c++) {
+      const codec_t *codec = &codecs[c];
+      if (codec->sixteenbits && !distributions[d].sixteenbits)
+        continue;
+      size_t compsize = 0, usedbytes = 0;
+      double encodetime = 1e30, decodetime = 1e30;
+      for (int i = 0; i < NTrials; i++) {
+        double t0 = now();
+        compsize = codec->encode(datain, N, compressedbuffer);
+        double t1 = now();
+        usedbytes = codec->decode(compressedbuffer, recovdata, N);
+        double t2 = now();
+        if (t1 - t0 < encodetime)
+          encodetime = t1 - t0;
+        if (t2 - t1 < decodetime)
+          decodetime = t2 - t1;
+      }
+#if defined(__SSSE3__)
+      if (codec->sixteenbits)
+        for (size_t k = 0; k < N; ++k)
+          recovdata[k] = shortout[k];
+#endif
+      if (compsize != usedbytes ||
+          memcmp(datain, recovdata, N * sizeof(uint32_t)) != 0) {
+        printf("%s: round trip failed on %s\n", codec->name,
+               distributions[d].name);
+        return -1;
+      }
+      // bandwidth is measured on the uncompressed side: 4 bytes per integer
+      // (even for short_varint, which writes 16-bit integers)
+      double bandwidth = N * sizeof(uint32_t) / decodetime / 1e9;
+      if (codec->encode == memcpy_encode)
+        memcpybandwidth = bandwidth;
+      printf("%-12s %-12s %8.2f %8.2f %12.1f %12.1f %10.2f %7.1f%%\n",
+             distributions[d].name, codec->name, compsize * 8.0 / N,
+             N * sizeof(uint32_t) / (double)compsize, N / encodetime / 1e6,
+             N / decodetime / 1e6, bandwidth,
+             100 * bandwidth / memcpybandwidth);
+    }
+  }
+  free(datain);
+  free(recovdata);
+  free(compressedbuffer);
+#if defined(__SSSE3__)
+  free(shortin);
+  free(shortout);
+#endif
+  return 0;
+}
@@ -1,63 +1,368 @@
-#include <assert.h>
+// Benchmark suite for the encoding and decoding kernels.
+//
+// usage: ./perf [--format text|csv|json] [--runs N] [--compare baseline.csv]
+//               [--threshold fraction]
+//
+// Every (kernel, distribution, size) combination is timed over repeated runs
+// and reported with its median and median absolute deviation (MAD).
+// With --compare, the results are matched against a baseline produced
+// earlier with --format csv and the program exits with status 1 if any
+// combination got significantly slower, see is_regression().
+#define _POSIX_C_SOURCE 199309L
 #include <stdio.h>
 #include <stdlib.h>
-#include <sys/resource.h>
+#include <string.h>
 #include <time.h>
 
 #include "streamvbyte.h"
-//static inline void rdtsc(unsigned long long *destination) {
-//  uint64_t t;
-  //  __asm__ volatile(".byte 0x0f, 0x31" : "=A"(t));
-//  *destination = 0;
-//}
-
-int main() {
-  int N = 500000;
-  int NTrials = 100;
-  uint32_t datain[N];
-  uint8_t compressedbuffer[N * 5];
-  uint32_t recovdata[N];
-
-  for (int k = 0; k < N; ++k)
-    datain[k] = rand() >> (31 & rand());
-
-  size_t compsize = 0;
-
-  //  uint64_t tsc, tsc2;
-  //  rdtsc(&tsc);
-  struct rusage before;
-  getrusage(RUSAGE_SELF, &before);
-
-  for (int i = 0; i < NTrials; i++)
-    compsize = streamvbyte_encode(datain, N, compressedbuffer); // encoding
-
-  struct rusage after;
-  getrusage(RUSAGE_SELF, &after);
-
-  float t = (after.ru_utime.tv_usec-before.ru_utime.tv_usec)/1000000.0;
-  printf("time = %f  %f uints/sec\n", t, N*NTrials/t); 
-  //  rdtsc(&tsc2);
-  //tsc2 -= tsc;
-  //printf("cycles/quadword %llu\n", (4 * tsc2) / (N * 200));
-  // here the result is stored in compressedbuffer using compsize bytes
-  size_t compsize2 = streamvbyte_decode(compressedbuffer, recovdata,
-                                        N); // decoding (fast)
-
-  printf("compsize=%zu compsize2 = %zu\n", compsize, compsize2);
-  //  assert(compsize == compsize2);
-
-  int k;
-  for (k = 0; k < N && datain[k] == recovdata[k]; k++) 
-    ;
- 
-  if(k < N)
-    printf("mismatch at %d before=%d after=%d\n", k, datain[k], recovdata[k]);
-
-  assert( k >= N );
-
-  //  free(datain);
-  //free(compressedbuffer);
-  //free(recovdata);
-  printf("Compressed %d integers down to %d bytes.\n", N, (int)compsize);
+#include "streamvbytedelta.h"
+#include "streamvbyterle.h"
+#include "streamvbytearchive.h"
+#include "streamvbytetransform.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define HAVE_RDTSC 1
+#endif
+
+#ifdef __AVX2__
+#define ISA "avx2"
+#elif defined(__AVX__)
+#define ISA "avx"
+#elif defined(__ARM_NEON__)
+#define ISA "neon"
+#else
+#define ISA "scalar"
+#endif
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1000000000.0;
+}
+
+static uint64_t ticks(void) {
+#ifdef HAVE_RDTSC
+  return __rdtsc();
+#else
   return 0;
+#endif
+}
+
+/* data */
+
+static uint32_t uniform8(uint32_t k) { (void)k; return rand() & 0xFF; }
+static uint32_t uniform16(uint32_t k) { (void)k; return rand() & 0xFFFF; }
+static uint32_t skewed(uint32_t k) { (void)k; return rand() >> (31 & rand()); }
+static uint32_t uniform32(uint32_t k) {
+  (void)k;
+  return (uint32_t)rand() << 16 ^ rand();
+}
+static uint32_t sorted(uint32_t k) { return k * 10 + rand() % 10; }
+// alternates 32 integers of identical byte length with 32 random integers,
+// exercising the choice between the uniform and the general decoding paths
+static uint32_t stretches(uint32_t k) {
+  return (k / 32) % 2 ? skewed(k) : 0x3F3F3F3Fu >> (8 * ((k / 64) % 4));
+}
+
+typedef struct {
+  const char *name;
+  uint32_t (*generate)(uint32_t k); // k is the index of the value
+} distribution_t;
+
+static const distribution_t distributions[] = {
+    {"uniform8", uniform8},   {"uniform16", uniform16},
+    {"skewed", skewed},       {"uniform32", uniform32},
+    {"sorted", sorted},       {"stretches", stretches},
+};
+
+static const uint32_t sizes[] = {1024, 65536, 4194304};
+
+/* kernels */
+
+typedef struct {
+  uint32_t *datain;
+  uint8_t *compressed;
+  uint32_t *recovdata;
+  uint32_t count;
+  size_t compsize;
+} buffers_t;
+
+static void run_encode(buffers_t *b) {
+  b->compsize = streamvbyte_encode(b->datain, b->count, b->compressed);
+}
+static void run_decode(buffers_t *b) {
+  streamvbyte_decode(b->compressed, b->recovdata, b->count);
+}
+static void run_delta_encode(buffers_t *b) {
+  b->compsize = streamvbyte_delta_encode(b->datain, b->count, b->compressed, 0);
+}
+static void run_delta_decode(buffers_t *b) {
+  streamvbyte_delta_decode(b->compressed, b->recovdata, b->count, 0);
+}
+static void run_rle_encode(buffers_t *b) {
+  b->compsize = streamvbyte_rle_encode(b->datain, b->count, b->compressed);
+}
+static void run_rle_decode(buffers_t *b) {
+  streamvbyte_rle_decode(b->compressed, b->recovdata, b->count);
+}
+static void run_archive_encode(buffers_t *b) {
+  b->compsize = streamvbyte_archive_encode(b->datain, b->count, b->compressed);
+}
+static void run_archive_decode(buffers_t *b) {
+  streamvbyte_archive_decode(b->compressed, b->recovdata, b->count);
+}
+static void run_transform_encode(buffers_t *b) {
+  b->compsize = streamvbyte_transform_encode(b->datain, b->count, b->compressed);
+}
+static void run_transform_decode(buffers_t *b) {
+  streamvbyte_transform_decode(b->compressed, b->recovdata, b->count);
+}
+
+typedef struct {
+  const char *name;
+  void (*prepare)(buffers_t *b); // produces the input of the kernel
+  void (*run)(buffers_t *b);
+} kernel_t;
+
+static const kernel_t kernels[] = {
+    {"encode", NULL, run_encode},
+    {"decode", run_encode, run_decode},
+    {"delta_encode", NULL, run_delta_encode},
+    {"delta_decode", run_delta_encode, run_delta_decode},
+    {"rle_encode", NULL, run_rle_encode},
+    {"rle_decode", run_rle_encode, run_rle_decode},
+    {"archive_encode", NULL, run_archive_encode},
+    {"archive_decode", run_archive_encode, run_archive_decode},
+    {"transform_encode", NULL, run_transform_encode},
+    {"transform_decode", run_transform_encode, run_transform_decode},
+};
+
+/* statistics */
+
+static int compare_doubles(const void *a, const void *b) {
+  double x = *(const double *)a, y = *(const double *)b;
+  return (x > y) - (x < y);
+}
+
+// sorts the values
+static double median(double *values, int n) {
+  qsort(values, n, sizeof(double), compare_doubles);
+  return n % 2 ? values[n / 2] : (values[n / 2 - 1] + values[n / 2]) / 2;
+}
+
+static double mad(const double *values, int n, double med, double *scratch) {
+  for (int i = 0; i < n; i++)
+    scratch[i] = values[i] > med ? values[i] - med : med - values[i];
+  return median(scratch, n);
+}
+
+/* records */
+
+typedef struct {
+  char kernel[32];
+  char isa[16];
+  char distribution[32];
+  uint32_t size;
+  double nsperint;    // median over the runs
+  double nsperintmad; // median absolute deviation over the runs
+  double gbpersec;    // uncompressed bytes (4 per integer) per second
+  double cyclesperint; // time stamp counter ticks, negative if unavailable
+  double ratio;        // uncompressed size over compressed size
+  int runs;
+} record_t;
+
+static const char *csvheader = "kernel,isa,distribution,size,ns_per_int,"
+                               "ns_per_int_mad,gb_per_s,cycles_per_int,ratio,"
+                               "runs";
+
+static void print_record(const record_t *r, const char *format, int first) {
+  if (strcmp(format, "csv") == 0) {
+    printf("%s,%s,%s,%u,%.6f,%.6f,%.4f,", r->kernel, r->isa, r->distribution,
+           r->size, r->nsperint, r->nsperintmad, r->gbpersec);
+    if (r->cyclesperint >= 0)
+      printf("%.4f", r->cyclesperint);
+    printf(",%.4f,%d\n", r->ratio, r->runs);
+  } else if (strcmp(format, "json") == 0) {
+    printf("%s\n  {\"kernel\": \"%s\", \"isa\": \"%s\", \"distribution\": "
+           "\"%s\", \"size\": %u, \"ns_per_int\": %.6f, \"ns_per_int_mad\": "
+           "%.6f, \"gb_per_s\": %.4f, \"cycles_per_int\": ",
+           first ? "[" : ",", r->kernel, r->isa, r->distribution, r->size,
+           r->nsperint, r->nsperintmad, r->gbpersec);
+    if (r->cyclesperint >= 0)
+      printf("%.4f", r->cyclesperint);
+    else
+      printf("null");
+    printf(", \"ratio\": %.4f, \"runs\": %d}", r->ratio, r->runs);
+  } else {
+    printf("%-14s %-6s %-10s %8u %10.4f %10.4f %8.2f %8.2f %6.2f\n", r->kernel,
+           r->isa, r->distribution, r->size, r->nsperint, r->nsperintmad,
+           r->gbpersec, r->cyclesperint, r->ratio);
+  }
+}
+
+static int load_baseline(const char *filename, record_t **records) {
+  FILE *f = fopen(filename, "r");
+  if (f == NULL)
+    return -1;
+  int n = 0, capacity = 64;
+  *records = malloc(capacity * sizeof(record_t));
+  char line[512];
+  while (fgets(line, sizeof(line), f) != NULL) {
+    record_t r;
+    // cycles_per_int may be empty, it is not needed for the comparison
+    if (sscanf(line, "%31[^,],%15[^,],%31[^,],%u,%lf,%lf,%lf,", r.kernel,
+               r.isa, r.distribution, &r.size, &r.nsperint, &r.nsperintmad,
+               &r.gbpersec) != 7)
+      continue; // header or malformed line
+    if (n == capacity) {
+      capacity *= 2;
+      *records = realloc(*records, capacity * sizeof(record_t));
+    }
+    (*records)[n++] = r;
+  }
+  fclose(f);
+  return n;
+}
+
+// A result is a regression when its median time exceeds the baseline median
+// by more than "threshold" (relative) and by more than three times the
+// combined spread of both measurements, so that noisy results do not trip it.
+// 1.4826 * MAD estimates the standard deviation of normally distributed runs.
+static int is_regression(const record_t *base, const record_t *current,
+                         double threshold) {
+  double difference = current->nsperint - base->nsperint;
+  double noise = 3 * 1.4826 * (base->nsperintmad + current->nsperintmad);
+  return difference > threshold * base->nsperint && difference > noise;
+}
+
+int main(int argc, char **argv) {
+  const char *format = "text";
+  const char *baselinefile = NULL;
+  int runs = 15;
+  double threshold = 0.05;
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--format") == 0 && i + 1 < argc)
+      format = argv[++i];
+    else if (strcmp(argv[i], "--runs") == 0 && i + 1 < argc)
+      runs = atoi(argv[++i]);
+    else if (strcmp(argv[i], "--compare") == 0 && i + 1 < argc)
+      baselinefile = argv[++i];
+    else if (strcmp(argv[i], "--threshold") == 0 && i + 1 < argc)
+      threshold = atof(argv[++i]);
+    else {
+      fprintf(stderr, "usage: %s [--format text|csv|json] [--runs N] "
+                      "[--compare baseline.csv] [--threshold fraction]\n",
+              argv[0]);
+      return 2;
+    }
+  }
+  if (runs < 1)
+    runs = 1;
+
+  record_t *baseline = NULL;
+  int nbaseline = 0;
+  if (baselinefile != NULL) {
+    nbaseline = load_baseline(baselinefile, &baseline);
+    if (nbaseline < 0) {
+      fprintf(stderr, "cannot read %s\n", baselinefile);
+      return 2;
+    }
+  }
+
+  const size_t nsizes = sizeof(sizes) / sizeof(sizes[0]);
+  const size_t ndistributions = sizeof(distributions) / sizeof(distributions[0]);
+  const size_t nkernels = sizeof(kernels) / sizeof(kernels[0]);
+  uint32_t maxcount = sizes[nsizes - 1];
+  buffers_t b;
+  b.datain = malloc(maxcount * sizeof(uint32_t));
+  b.recovdata = malloc(maxcount * sizeof(uint32_t));
+  b.compressed = malloc(streamvbyte_rle_max_compressedbytes(maxcount));
+  double *times = malloc(runs * sizeof(double));
+  double *scratch = malloc(runs * sizeof(double));
+  uint64_t *tickcounts = malloc(runs * sizeof(uint64_t));
+  int regressions = 0, first = 1;
+
+  if (strcmp(format, "csv") == 0)
+    printf("%s\n", csvheader);
+  else if (strcmp(format, "text") == 0)
+    printf("%-14s %-6s %-10s %8s %10s %10s %8s %8s %6s\n", "kernel", "isa",
+           "dist", "size", "ns/int", "mad", "GB/s", "cyc/int", "ratio");
+  for (size_t s = 0; s < nsizes; s++) {
+    b.count = sizes[s];
+    // repeat small sizes so that each run lasts long enough to be timed
+    int repeat = (int)(sizes[nsizes - 1] / sizes[s]);
+    for (size_t d = 0; d < ndistributions; d++) {
+      srand(1234);
+      for (uint32_t k = 0; k < b.count; ++k)
+        b.datain[k] = distributions[d].generate(k);
+      for (size_t k = 0; k < nkernels; k++) {
+        const kernel_t *kernel = &kernels[k];
+        if (kernel->prepare != NULL)
+          kernel->prepare(&b);
+        kernel->run(&b); // warm up
+        for (int i = 0; i < runs; i++) {
+          uint64_t t0 = ticks();
+          double start = now();
+          for (int j = 0; j < repeat; j++)
+            kernel->run(&b);
+          times[i] = (now() - start) * 1e9 / ((double)repeat * b.count);
+          tickcounts[i] = ticks() - t0;
+        }
+        if (kernel->prepare != NULL &&
+            memcmp(b.datain, b.recovdata, b.count * sizeof(uint32_t)) != 0) {
+          fprintf(stderr, "%s: round trip failed on %s\n", kernel->name,
+                  distributions[d].name);
+          return -1;
+        }
+        record_t r;
+        snprintf(r.kernel, sizeof(r.kernel), "%s", kernel->name);
+        snprintf(r.isa, sizeof(r.isa), "%s", ISA);
+        snprintf(r.distribution, sizeof(r.distribution), "%s",
+                 distributions[d].name);
+        r.size = b.count;
+        r.runs = runs;
+        r.ratio = b.count * sizeof(uint32_t) / (double)b.compsize;
+        for (int i = 0; i < runs; i++)
+          scratch[i] = (double)tickcounts[i];
+        r.cyclesperint = median(scratch, runs) / ((double)repeat * b.count);
+#ifndef HAVE_RDTSC
+        r.cyclesperint = -1;
+#endif
+        r.nsperintmad = mad(times, runs, median(times, runs), scratch);
+        r.nsperint = median(times, runs);
+        r.gbpersec = sizeof(uint32_t) / r.nsperint;
+        print_record(&r, format, first);
+        first = 0;
+        for (int i = 0; i < nbaseline; i++) {
+          const record_t *base = &baseline[i];
+          if (strcmp(base->kernel, r.kernel) == 0 &&
+              strcmp(base->isa, r.isa) == 0 &&
+              strcmp(base->distribution, r.distribution) == 0 &&
+              base->size == r.size && is_regression(base, &r, threshold)) {
+            fprintf(stderr,
+                    "REGRESSION %s %s %s %u: %.4f ns/int (mad %.4f) vs "
+                    "baseline %.4f ns/int (mad %.4f)\n",
+                    r.kernel, r.isa, r.distribution, r.size, r.nsperint,
+                    r.nsperintmad, base->nsperint, base->nsperintmad);
+            regressions++;
+          }
+        }
+      }
+    }
+  }
+  if (strcmp(format, "json") == 0)
+    printf("%s]\n", first ? "[" : "\n");
+  if (baselinefile != NULL)
+    fprintf(stderr, "%d regression(s) against %s\n", regressions,
+            baselinefile);
+
+  free(b.datain);
+  free(b.recovdata);
+  free(b.compressed);
+  free(times);
+  free(scratch);
+  free(tickcounts);
+  free(baseline);
+  return regressions > 0 ? 1 : 0;
 }
@@ -0,0 +1,333 @@
+// Multi-threaded scaling benchmark: how the aggregate throughput grows with
+// the number of threads coding at once, from buffers that fit in L1 to
+// buffers that only fit in memory, to size machines by memory bandwidth.
+//
+// usage: ./scaling_perf [--op decode|encode|delta_decode|delta_encode]
+//                       [--shared] [--threads 1,2,4,...] [--sizes 16K,256K,...]
+//                       [--seconds S] [--format text|csv]
+//
+// Each thread is pinned to a processor of its own (on Linux, round-robin
+// over the processors the process may run on) and codes its buffer over and
+// over for S seconds (default 0.5). The buffers are allocated and first
+// touched by the thread using them (so that they are local to its memory
+// node), unless --shared is given: all threads then read the same input and
+// only their outputs are private. Sizes are the uncompressed bytes per
+// thread (default 16K,256K,4M,64M, suffixes K, M and G are powers of 1024),
+// thread counts default to the powers of two up to the number of
+// processors, and that number.
+//
+// Reported for each size and number of threads: the aggregate bandwidth
+// (GB/s of uncompressed integers, and of compressed bytes read or written),
+// the speed of each thread (millions of integers per second, average) and the
+// slowdown: the speed of a thread with the first number of threads (1 by
+// default, running alone) over the speed of a thread with the others running
+// (1.00 is perfect scaling).
+#define _GNU_SOURCE // for pthread_setaffinity_np and sched_getaffinity
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+#include "streamvbyte.h"
+#include "streamvbytedelta.h"
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1000000000.0;
+}
+
+/* operations: each one reads "in" and writes "out", returns the number of
+   compressed bytes */
+
+static size_t op_decode(const void *in, void *out, size_t count) {
+  return streamvbyte_decode64(in, out, count);
+}
+
+static size_t op_encode(const void *in, void *out, size_t count) {
+  return streamvbyte_encode64(in, count, out);
+}
+
+static size_t op_delta_decode(const void *in, void *out, size_t count) {
+  return streamvbyte_delta_decode64(in, out, count, 0);
+}
+
+static size_t op_delta_encode(const void *in, void *out, size_t count) {
+  return streamvbyte_delta_encode64(in, count, out, 0);
+}
+
+typedef struct {
+  const char *name;
+  size_t (*run)(const void *in, void *out, size_t count);
+  int decodes; // reads compressed bytes, writes integers
+  int delta;   // sorted input
+} operation_t;
+
+static const operation_t operations[] = {
+    {"decode", op_decode, 1, 0},
+    {"encode", op_encode, 0, 0},
+    {"delta_decode", op_delta_decode, 1, 1},
+    {"delta_encode", op_delta_encode, 0, 1},
+};
+
+/* threads */
+
+typedef struct {
+  const operation_t *op;
+  const void *source; // the input, copied by the thread unless shared
+  size_t sourcebytes;
+  int shared;
+  size_t count;       // integers coded per call
+  size_t outbytes;
+  double seconds;
+  int cpu;            // -1: not pinned
+  // results
+  uint64_t calls;
+  double elapsed;
+  void *out;          // the last output, for checking
+} worker_t;
+
+static pthread_mutex_t gate_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t gate_cond = PTHREAD_COND_INITIALIZER;
+static int gate_ready; // threads done with their setup
+static int gate_open;
+
+static void *worker_main(void *arg) {
+  worker_t *w = arg;
+#if defined(__linux__)
+  if (w->cpu >= 0) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(w->cpu, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+  }
+#endif
+  // allocated and touched after pinning: the pages are local to the thread
+  const void *in = w->source;
+  void *copy = NULL;
+  if (!w->shared) {
+    copy = malloc(w->sourcebytes);
+    if (copy != NULL)
+      memcpy(copy, w->source, w->sourcebytes);
+    in = copy;
+  }
+  w->out = malloc(w->outbytes);
+  if (in == NULL || w->out == NULL) {
+    fprintf(stderr, "out of memory\n");
+    exit(1);
+  }
+  memset(w->out, 0, w->outbytes);
+  w->op->run(in, w->out, w->count); // warm up
+
+  pthread_mutex_lock(&gate_lock);
+  gate_ready++;
+  pthread_cond_broadcast(&gate_cond);
+  while (!gate_open)
+    pthread_cond_wait(&gate_cond, &gate_lock);
+  pthread_mutex_unlock(&gate_lock);
+
+  double start = now(), elapsed;
+  uint64_t calls = 0;
+  do {
+    w->op->run(in, w->out, w->count);
+    calls++;
+    elapsed = now() - start;
+  } while (elapsed < w->seconds);
+  w->calls = calls;
+  w->elapsed = elapsed;
+  free(copy);
+  return NULL;
+}
+
+/* command line */
+
+// comma-separated list of sizes with optional K, M, G suffixes
+static size_t parse_list(const char *arg, size_t *values, size_t max) {
+  size_t n = 0;
+  while (*arg && n < max) {
+    char *end;
+    double v = strtod(arg, &end);
+    if (*end == 'K' || *end == 'k')
+      v *= 1024, end++;
+    else if (*end == 'M' || *end == 'm')
+      v *= 1024 * 1024, end++;
+    else if (*end == 'G' || *end == 'g')
+      v *= 1024 * 1024 * 1024, end++;
+    if (end == arg || v < 1)
+      break;
+    values[n++] = (size_t)v;
+    arg = *end == ',' ? end + 1 : end;
+  }
+  return n;
+}
+
+// the processors the process may run on, round-robin
+static int cpus[1024];
+static int ncpus;
+
+static void find_cpus(void) {
+#if defined(__linux__)
+  cpu_set_t set;
+  if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+    for (int c = 0; c < CPU_SETSIZE && ncpus < 1024; c++)
+      if (CPU_ISSET(c, &set))
+        cpus[ncpus++] = c;
+  }
+#endif
+  if (ncpus == 0) {
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    ncpus = n > 0 ? (int)n : 1;
+    for (int c = 0; c < ncpus; c++)
+      cpus[c] = -1; // not pinned
+  }
+}
+
+int main(int argc, char **argv) {
+  const operation_t *op = &operations[0];
+  int shared = 0;
+  double seconds = 0.5;
+  const char *format = "text";
+  size_t threads[64], nthreads = 0;
+  size_t sizes[64] = {16 << 10, 256 << 10, 4 << 20, 64 << 20};
+  size_t nsizes = 4;
+  find_cpus();
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--op") == 0 && i + 1 < argc) {
+      const char *name = argv[++i];
+      op = NULL;
+      for (size_t o = 0; o < sizeof(operations) / sizeof(operations[0]); o++)
+        if (strcmp(operations[o].name, name) == 0)
+          op = &operations[o];
+    } else if (strcmp(argv[i], "--shared") == 0)
+      shared = 1;
+    else if (strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+      nthreads = parse_list(argv[++i], threads, 64);
+    else if (strcmp(argv[i], "--sizes") == 0 && i + 1 < argc)
+      nsizes = parse_list(argv[++i], sizes, 64);
+    else if (strcmp(argv[i], "--seconds") == 0 && i + 1 < argc)
+      seconds = atof(argv[++i]);
+    else if (strcmp(argv[i], "--format") == 0 && i + 1 < argc)
+      format = argv[++i];
+    else
+      op = NULL;
+    if (op == NULL)
+      break;
+  }
+  if (op == NULL || nsizes == 0 || seconds <= 0) {
+    fprintf(stderr,
+            "usage: %s [--op decode|encode|delta_decode|delta_encode] "
+            "[--shared] [--threads 1,2,4,...] [--sizes 16K,256K,...] "
+            "[--seconds S] [--format text|csv]\n",
+            argv[0]);
+    return 1;
+  }
+  if (nthreads == 0) {
+    for (size_t t = 1; t < (size_t)ncpus && nthreads < 63; t *= 2)
+      threads[nthreads++] = t;
+    threads[nthreads++] = ncpus;
+  }
+
+  int csv = strcmp(format, "csv") == 0;
+  if (csv)
+    printf("op,mode,bytes,threads,gbps,compressed_gbps,mints_per_thread,"
+           "slowdown\n");
+  else
+    printf("%s, %s buffers, %d processors\n%10s %8s %10s %10s %12s %9s\n",
+           op->name, shared ? "shared" : "private", ncpus, "size",
+           "threads", "GB/s", "comp GB/s", "Mint/s/thr", "slowdown");
+
+  for (size_t s = 0; s < nsizes; s++) {
+    size_t count = sizes[s] / sizeof(uint32_t);
+    if (count == 0)
+      count = 1;
+    // skewed values, as in codec_perf, sorted for differential coding
+    uint32_t *data = malloc(count * sizeof(uint32_t));
+    uint8_t *compressed = malloc(streamvbyte_max_compressedbytes(count));
+    if (data == NULL || compressed == NULL) {
+      fprintf(stderr, "out of memory\n");
+      return 1;
+    }
+    srand(1234);
+    uint32_t prev = 0;
+    for (size_t k = 0; k < count; k++)
+      data[k] = op->delta ? (prev += rand() % 100)
+                          : (uint32_t)rand() >> (31 & rand());
+    size_t compsize = op->delta
+                          ? streamvbyte_delta_encode64(data, count, compressed, 0)
+                          : streamvbyte_encode64(data, count, compressed);
+
+    double alone = 0; // speed of a thread with the first number of threads
+    for (size_t t = 0; t < nthreads; t++) {
+      size_t n = threads[t];
+      worker_t *workers = calloc(n, sizeof(worker_t));
+      pthread_t *ids = malloc(n * sizeof(pthread_t));
+      gate_ready = 0;
+      gate_open = 0;
+      for (size_t i = 0; i < n; i++) {
+        worker_t *w = &workers[i];
+        w->op = op;
+        w->source = op->decodes ? (const void *)compressed : (const void *)data;
+        w->sourcebytes = op->decodes ? compsize : count * sizeof(uint32_t);
+        w->shared = shared;
+        w->count = count;
+        w->outbytes = op->decodes ? count * sizeof(uint32_t)
+                                  : streamvbyte_max_compressedbytes(count);
+        w->seconds = seconds;
+        w->cpu = cpus[i % ncpus];
+        pthread_create(&ids[i], NULL, worker_main, w);
+      }
+      pthread_mutex_lock(&gate_lock);
+      while (gate_ready < (int)n)
+        pthread_cond_wait(&gate_cond, &gate_lock);
+      gate_open = 1;
+      pthread_cond_broadcast(&gate_cond);
+      pthread_mutex_unlock(&gate_lock);
+      double start = now();
+      for (size_t i = 0; i < n; i++)
+        pthread_join(ids[i], NULL);
+      double wall = now() - start;
+
+      double integers = 0, perthread = 0;
+      for (size_t i = 0; i < n; i++) {
+        integers += (double)workers[i].calls * count;
+        perthread += workers[i].calls * count / workers[i].elapsed;
+      }
+      perthread /= n;
+      if (t == 0)
+        alone = perthread;
+      double gbps = integers * sizeof(uint32_t) / wall / 1e9;
+      double compgbps = integers * compsize / count / wall / 1e9;
+
+      // the output of the last call must be right
+      const void *expected =
+          op->decodes ? (const void *)data : (const void *)compressed;
+      size_t expectedbytes = op->decodes ? count * sizeof(uint32_t) : compsize;
+      for (size_t i = 0; i < n; i++) {
+        if (memcmp(workers[i].out, expected, expectedbytes) != 0) {
+          fprintf(stderr, "%s: wrong output\n", op->name);
+          return 1;
+        }
+        free(workers[i].out);
+      }
+      free(workers);
+      free(ids);
+
+      if (csv)
+        printf("%s,%s,%zu,%zu,%.3f,%.3f,%.1f,%.3f\n", op->name,
+               shared ? "shared" : "private", sizes[s], n, gbps, compgbps,
+               perthread / 1e6, alone / perthread);
+      else
+        printf("%10zu %8zu %10.2f %10.2f %12.1f %9.2f\n", sizes[s], n, gbps,
+               compgbps, perthread / 1e6, alone / perthread);
+      fflush(stdout);
+    }
+    free(data);
+    free(compressed);
+  }
+  return 0;
+}
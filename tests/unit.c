@@ -1,5 +1,17 @@
 #include "streamvbyte.h"
 #include "streamvbytedelta.h"
+#include "streamvbytecolumns.h"
+#include "streamvbyterle.h"
+#include "streamvbytearchive.h"
+#include "streamvbytetransform.h"
+#include "streamvbyteblockmax.h"
+#include "streamvbytepostings.h"
+#include "streamvbyteupdatable.h"
+#include "streamvbytecache.h"
+#include "streamvbytebatch.h"
+#include "streamvbyteinterleaved.h"
+#include "streamvbyteset.h"
+#include "streamvbyteseries.h"
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -119,11 +131,1068 @@ int aqrittests() {
   return 0;
 }
 
+// return -1 in case of failure
+int columnstests() {
+  enum { NCOLUMNS = 3, N = 1000 };
+  struct row {
+    uint32_t a;
+    uint8_t pad;
+    uint32_t b;
+    uint32_t c;
+  } __attribute__((packed));
+  const size_t offsets[NCOLUMNS] = {0, 5, 9};
+  struct row *rows = malloc(N * sizeof(struct row));
+  struct row *recovrows = malloc(N * sizeof(struct row));
+  uint32_t *columns[NCOLUMNS];
+  uint32_t *recovcolumns[NCOLUMNS];
+  uint8_t *compressed[NCOLUMNS];
+  uint8_t *expected[NCOLUMNS];
+  size_t sizes[NCOLUMNS];
+  size_t usedbytes[NCOLUMNS];
+  int result = 0;
+  for (int i = 0; i < NCOLUMNS; i++) {
+    columns[i] = malloc(N * sizeof(uint32_t));
+    recovcolumns[i] = malloc(N * sizeof(uint32_t));
+    compressed[i] = malloc(streamvbyte_max_compressedbytes(N));
+    expected[i] = malloc(streamvbyte_max_compressedbytes(N));
+  }
+  // the key bytes of the longest streams do not wrap around
+  if (streamvbyte_columns_keybytes(UINT32_MAX) != (size_t)1 << 30 ||
+      streamvbyte_columns_keybytes(UINT32_MAX - 3) != ((size_t)1 << 30) - 1) {
+    printf("[columnstests] code is buggy, bad key length\n");
+    result = -1;
+    goto cleanup;
+  }
+  for (uint32_t length = 0; length <= N; length = length * 2 + 7) {
+    for (uint32_t k = 0; k < length; k++) {
+      rows[k].a = columns[0][k] = rand() >> (31 & rand());
+      rows[k].pad = (uint8_t)k;
+      rows[k].b = columns[1][k] = k;
+      rows[k].c = columns[2][k] = rand() % 300;
+    }
+    for (int layout = 0; layout < 2; layout++) {
+      size_t total =
+          layout == 0
+              ? streamvbyte_encode_columns((const uint32_t *const *)columns,
+                                           NCOLUMNS, length, compressed, sizes)
+              : streamvbyte_encode_rows((const uint8_t *)rows,
+                                        sizeof(struct row), offsets, NCOLUMNS,
+                                        length, compressed, sizes);
+      size_t expectedtotal = 0;
+      for (int i = 0; i < NCOLUMNS; i++) {
+        size_t compsize = streamvbyte_encode(columns[i], length, expected[i]);
+        expectedtotal += compsize;
+        if (compsize != sizes[i] ||
+            memcmp(compressed[i], expected[i], compsize) != 0) {
+          printf("[columnstests] code is buggy, column %d differs\n", i);
+          result = -1;
+          goto cleanup;
+        }
+      }
+      if (total != expectedtotal) {
+        printf("[columnstests] code is buggy, total size mismatch\n");
+        result = -1;
+        goto cleanup;
+      }
+      memset(recovrows, 0, N * sizeof(struct row));
+      size_t usedtotal =
+          layout == 0
+              ? streamvbyte_decode_columns((const uint8_t *const *)compressed,
+                                           recovcolumns, NCOLUMNS, length,
+                                           usedbytes)
+              : streamvbyte_decode_rows((const uint8_t *const *)compressed,
+                                        (uint8_t *)recovrows,
+                                        sizeof(struct row), offsets, NCOLUMNS,
+                                        length, usedbytes);
+      if (usedtotal != total ||
+          memcmp(usedbytes, sizes, sizeof(sizes)) != 0) {
+        printf("[columnstests] code is buggy, size mismatch\n");
+        result = -1;
+        goto cleanup;
+      }
+      for (uint32_t k = 0; k < length; k++) {
+        int ok = layout == 0 ? (recovcolumns[0][k] == rows[k].a &&
+                                recovcolumns[1][k] == rows[k].b &&
+                                recovcolumns[2][k] == rows[k].c)
+                             : (recovrows[k].a == rows[k].a &&
+                                recovrows[k].pad == 0 &&
+                                recovrows[k].b == rows[k].b &&
+                                recovrows[k].c == rows[k].c);
+        if (!ok) {
+          printf("[columnstests] code is buggy, row %d differs\n", (int)k);
+          result = -1;
+          goto cleanup;
+        }
+      }
+    }
+  }
+cleanup:
+  for (int i = 0; i < NCOLUMNS; i++) {
+    free(columns[i]);
+    free(recovcolumns[i]);
+    free(compressed[i]);
+    free(expected[i]);
+  }
+  free(rows);
+  free(recovrows);
+  return result;
+}
+
+// return -1 in case of failure
+// blocks of 32 integers of the same byte length take a different decoding
+// path than mixed blocks, so we alternate both kinds
+int uniformtests() {
+  int N = 4096;
+  uint32_t *datain = malloc(N * sizeof(uint32_t));
+  uint8_t *compressedbuffer = malloc(streamvbyte_max_compressedbytes(N));
+  uint32_t *recovdata = malloc(N * sizeof(uint32_t));
+  int result = 0;
+  for (int width = 0; width < 4; width++) {
+    for (int k = 0; k < N; ++k)
+      datain[k] = (k / 32) % 3 == 1 ? (uint32_t)rand() >> (31 & rand())
+                                    : 0xFFFFFFFF >> (8 * width) >> (k % 7);
+    size_t compsize = streamvbyte_encode(datain, N, compressedbuffer);
+    size_t usedbytes = streamvbyte_decode(compressedbuffer, recovdata, N);
+    if (compsize != usedbytes ||
+        memcmp(datain, recovdata, N * sizeof(uint32_t)) != 0) {
+      printf("[uniformtests] code is buggy width = %d\n", width);
+      result = -1;
+      break;
+    }
+  }
+  free(datain);
+  free(compressedbuffer);
+  free(recovdata);
+  return result;
+}
+
+// return -1 in case of failure
+// the encoders must not write past the compressed data
+int exactboundtests() {
+  const int N = 300, guard = 32;
+  uint32_t *datain = malloc(N * sizeof(uint32_t));
+  uint8_t *compressedbuffer = malloc(streamvbyte_max_compressedbytes(N) + guard);
+  for (int length = 0; length <= N; length++) {
+    for (uint32_t gap = 1; gap <= 387420489; gap *= 9) {
+      for (int k = 0; k < length; ++k)
+        datain[k] = (k % 5 == 0 ? 0 : gap) + (rand() % 8);
+      for (int delta = 0; delta < 2; delta++) {
+        size_t expected =
+            delta ? streamvbyte_delta_compressedbytes(datain, length, 3)
+                  : streamvbyte_compressedbytes(datain, length);
+        memset(compressedbuffer, 0xA5, expected + guard);
+        size_t compsize =
+            delta ? streamvbyte_delta_encode(datain, length, compressedbuffer, 3)
+                  : streamvbyte_encode(datain, length, compressedbuffer);
+        if (compsize != expected) {
+          printf("[exactboundtests] code is buggy, expected %d bytes, got %d\n",
+                 (int)expected, (int)compsize);
+          return -1;
+        }
+        for (int k = 0; k < guard; k++) {
+          if (compressedbuffer[compsize + k] != 0xA5) {
+            printf("[exactboundtests] code is buggy, wrote past %d bytes\n",
+                   (int)compsize);
+            return -1;
+          }
+        }
+      }
+    }
+  }
+  free(datain);
+  free(compressedbuffer);
+  return 0;
+}
+
+// return -1 in case of failure
+// the size_t entry points must produce and accept the same bytes
+int largecounttests() {
+  const size_t N = 1000;
+  uint32_t *datain = malloc(N * sizeof(uint32_t));
+  uint8_t *compressed = malloc(streamvbyte_max_compressedbytes64(N));
+  uint8_t *compressed64 = malloc(streamvbyte_max_compressedbytes64(N));
+  uint32_t *recovdata = malloc(N * sizeof(uint32_t));
+  int result = 0;
+  for (size_t k = 0; k < N; ++k)
+    datain[k] = (uint32_t)(k * k * 7);
+  for (size_t length = 0; length <= N && result == 0; length += 37) {
+    for (int delta = 0; delta < 2; delta++) {
+      size_t compsize =
+          delta ? streamvbyte_delta_encode(datain, length, compressed, 1)
+                : streamvbyte_encode(datain, length, compressed);
+      size_t compsize64 =
+          delta ? streamvbyte_delta_encode64(datain, length, compressed64, 1)
+                : streamvbyte_encode64(datain, length, compressed64);
+      size_t expected =
+          delta ? streamvbyte_delta_compressedbytes64(datain, length, 1)
+                : streamvbyte_compressedbytes64(datain, length);
+      size_t usedbytes =
+          delta ? streamvbyte_delta_decode64(compressed64, recovdata, length, 1)
+                : streamvbyte_decode64(compressed64, recovdata, length);
+      if (compsize != compsize64 || compsize != expected ||
+          compsize != usedbytes ||
+          memcmp(compressed, compressed64, compsize) != 0 ||
+          memcmp(datain, recovdata, length * sizeof(uint32_t)) != 0) {
+        printf("[largecounttests] code is buggy length = %d\n", (int)length);
+        result = -1;
+        break;
+      }
+    }
+  }
+  free(datain);
+  free(compressed);
+  free(compressed64);
+  free(recovdata);
+  return result;
+}
+
+// return -1 in case of failure
+int rletests() {
+  int N = 4096;
+  uint32_t *datain = malloc(N * sizeof(uint32_t));
+  uint8_t *compressedbuffer = malloc(streamvbyte_rle_max_compressedbytes(N));
+  uint8_t *regularbuffer = malloc(streamvbyte_max_compressedbytes(N));
+  uint32_t *recovdata = malloc(N * sizeof(uint32_t));
+  int result = 0;
+  for (int length = 0; length <= N && result == 0;) {
+    for (int pattern = 0; pattern < 4; pattern++) {
+      for (int k = 0; k < length; ++k) {
+        if (pattern == 0) // long runs of 0x00 control bytes
+          datain[k] = rand() % 200;
+        else if (pattern == 1) // no run at all
+          datain[k] = rand() >> (31 & rand());
+        else if (pattern == 2) // runs of various widths and lengths
+          datain[k] = 0xFFFFFFFF >> (8 * ((k / 37) % 4));
+        else // short runs mixed with literals
+          datain[k] = (k / 8) % 3 ? 7 : (uint32_t)rand();
+      }
+      size_t compsize =
+          streamvbyte_rle_encode(datain, length, compressedbuffer);
+      size_t usedbytes =
+          streamvbyte_rle_decode(compressedbuffer, recovdata, length);
+      size_t regularsize =
+          streamvbyte_encode(datain, length, regularbuffer);
+      if (compsize != usedbytes ||
+          memcmp(datain, recovdata, length * sizeof(uint32_t)) != 0) {
+        printf("[rletests] code is buggy length = %d pattern = %d\n", length,
+               pattern);
+        result = -1;
+        break;
+      }
+      if (pattern == 0 && length >= 64 && compsize >= regularsize) {
+        printf("[rletests] runs were not compressed length = %d\n", length);
+        result = -1;
+        break;
+      }
+    }
+    if (length < 128)
+      ++length;
+    else
+      length *= 2;
+  }
+  free(datain);
+  free(compressedbuffer);
+  free(regularbuffer);
+  free(recovdata);
+  return result;
+}
+
+// return -1 in case of failure
+int archivetests() {
+  int N = 4096;
+  uint32_t *datain = malloc(N * sizeof(uint32_t));
+  uint8_t *compressedbuffer = malloc(streamvbyte_archive_max_compressedbytes(N));
+  uint8_t *regularbuffer = malloc(streamvbyte_max_compressedbytes(N));
+  uint32_t *recovdata = malloc(N * sizeof(uint32_t));
+  int result = 0;
+  for (int length = 0; length <= N && result == 0;) {
+    for (int pattern = 0; pattern < 4; pattern++) {
+      int key = 0;
+      for (int k = 0; k < length; ++k) {
+        if (pattern == 0) // mostly one byte, a few larger values
+          datain[k] = rand() % 16 ? (uint32_t)(rand() % 200) : (uint32_t)rand();
+        else if (pattern == 1) // a single control byte value
+          datain[k] = 0xFFFFFFFF;
+        else if (pattern == 2) // evenly spread control bytes
+          datain[k] = rand() >> (8 * (rand() % 4));
+        else { // Fibonacci frequencies: Huffman codes exceed the length limit
+          if (k % 4 == 0) {
+            int q = k / 4, f0 = 1, f1 = 1;
+            for (key = 0; key < 13 && q >= f0; key++) {
+              q -= f0;
+              int f2 = f0 + f1;
+              f0 = f1;
+              f1 = f2;
+            }
+          }
+          int code = (key >> (2 * (k % 4))) & 3;
+          datain[k] = code == 0 ? 1 : 1u << (8 * code);
+        }
+      }
+      size_t compsize =
+          streamvbyte_archive_encode(datain, length, compressedbuffer);
+      size_t usedbytes =
+          streamvbyte_archive_decode(compressedbuffer, recovdata, length);
+      size_t regularsize =
+          streamvbyte_encode(datain, length, regularbuffer);
+      if (compsize != usedbytes ||
+          compsize > streamvbyte_archive_max_compressedbytes(length) ||
+          memcmp(datain, recovdata, length * sizeof(uint32_t)) != 0) {
+        printf("[archivetests] code is buggy length = %d pattern = %d\n",
+               length, pattern);
+        result = -1;
+        break;
+      }
+      if ((pattern == 0 || pattern == 1) && length >= 2048 &&
+          compsize >= regularsize) {
+        printf("[archivetests] keys were not compressed length = %d\n",
+               length);
+        result = -1;
+        break;
+      }
+    }
+    if (length < 128)
+      ++length;
+    else
+      length *= 2;
+  }
+  free(datain);
+  free(compressedbuffer);
+  free(regularbuffer);
+  free(recovdata);
+  return result;
+}
+
+// return -1 in case of failure
+int transformtests() {
+  int N = 4096;
+  uint32_t *datain = malloc(N * sizeof(uint32_t));
+  uint8_t *compressedbuffer =
+      malloc(streamvbyte_transform_max_compressedbytes(N));
+  uint32_t *recovdata = malloc(N * sizeof(uint32_t));
+  int result = 0;
+  for (int length = 0; length <= N && result == 0;) {
+    // each pattern should select the matching transform
+    for (int transform = 0; transform < 4; transform++) {
+      uint32_t val = 1000000;
+      for (int k = 0; k < length; ++k) {
+        if (transform == STREAMVBYTE_TRANSFORM_NONE) // independent values
+          datain[k] = rand() >> (31 & rand());
+        else if (transform == STREAMVBYTE_TRANSFORM_DELTA) // sorted
+          datain[k] = val += rand() % 100;
+        else if (transform == STREAMVBYTE_TRANSFORM_ZIGZAG_DELTA) // random walk
+          datain[k] = val += rand() % 200 - 100;
+        else // shared high bits
+          datain[k] = 0xABCD0000 | (rand() & 0xFF);
+      }
+      size_t compsize =
+          streamvbyte_transform_encode(datain, length, compressedbuffer);
+      // decoded from a copy of the exact size, so that a sanitizer catches
+      // reads past the stream
+      uint8_t *exact = malloc(compsize > 0 ? compsize : 1);
+      memcpy(exact, compressedbuffer, compsize);
+      size_t usedbytes = streamvbyte_transform_decode(exact, recovdata, length);
+      free(exact);
+      if (compsize != usedbytes ||
+          compsize > streamvbyte_transform_max_compressedbytes(length) ||
+          memcmp(datain, recovdata, length * sizeof(uint32_t)) != 0) {
+        printf("[transformtests] code is buggy length = %d transform = %d\n",
+               length, transform);
+        result = -1;
+        break;
+      }
+      // the tag of the second block (the first one starts from 0)
+      if (length >= 2 * STREAMVBYTE_TRANSFORM_BLOCK) {
+        size_t second = 1 + STREAMVBYTE_TRANSFORM_BLOCK / 4;
+        const uint8_t *keys = compressedbuffer + 1;
+        for (int i = 0; i < STREAMVBYTE_TRANSFORM_BLOCK / 4; i++)
+          second += 4 + (keys[i] & 3) + (keys[i] >> 2 & 3) +
+                    (keys[i] >> 4 & 3) + (keys[i] >> 6 & 3);
+        if (compressedbuffer[second] != transform) {
+          printf("[transformtests] transform %d not selected length = %d\n",
+                 transform, length);
+          result = -1;
+          break;
+        }
+      }
+    }
+    if (length < 300) // up to a few values past the second block
+      ++length;
+    else
+      length *= 2;
+  }
+  free(datain);
+  free(compressedbuffer);
+  free(recovdata);
+  return result;
+}
+
+// return -1 in case of failure
+int blockmaxtests() {
+  uint32_t N = 10000;
+  uint32_t *docids = malloc(N * sizeof(uint32_t));
+  uint32_t *values = malloc(N * sizeof(uint32_t));
+  uint32_t *recovdocids = malloc(N * sizeof(uint32_t));
+  uint32_t *recovvalues = malloc(N * sizeof(uint32_t));
+  uint32_t docid = 0;
+  for (uint32_t k = 0; k < N; ++k) {
+    docids[k] = docid += 1 + rand() % 1000;
+    values[k] = rand() % 64 ? rand() % 16 : rand() % 1000; // a few high values
+  }
+  int result = 0;
+  // a block size of 0 is rejected
+  if (streamvbyte_blockmax_blocks(N, 0) != 0 ||
+      streamvbyte_blockmax_encode(docids, values, N, 0, NULL, NULL) != 0) {
+    printf("[blockmaxtests] accepted blocksize = 0\n");
+    result = -1;
+  }
+  uint32_t blocksizes[] = {128, 100, 1, UINT32_MAX};
+  for (size_t s = 0; s < 4 && result == 0; s++) {
+    uint32_t blocksize = blocksizes[s];
+    uint32_t length = N - (uint32_t)s; // last block shorter
+    size_t nblocks = streamvbyte_blockmax_blocks(length, blocksize);
+    streamvbyte_block_t *blocks = malloc(nblocks * sizeof(streamvbyte_block_t));
+    uint8_t *compressed =
+        malloc(streamvbyte_blockmax_max_compressedbytes(length, blocksize));
+    streamvbyte_blockmax_encode(docids, values, length, blocksize, compressed,
+                                blocks);
+    // every block decodes alone
+    for (size_t b = nblocks; b-- > 0;) {
+      size_t count = streamvbyte_blockmax_decode_block(
+          compressed, blocks, b, length, blocksize, recovdocids + b * blocksize,
+          recovvalues + b * blocksize);
+      if (count != (b + 1 < nblocks ? blocksize : length - b * blocksize)) {
+        printf("[blockmaxtests] bad block length = %d\n", (int)count);
+        result = -1;
+      }
+    }
+    if (memcmp(docids, recovdocids, length * sizeof(uint32_t)) != 0 ||
+        memcmp(values, recovvalues, length * sizeof(uint32_t)) != 0) {
+      printf("[blockmaxtests] code is buggy blocksize = %d\n", blocksize);
+      result = -1;
+    }
+    // entries with docid >= target and value > threshold, skipping blocks
+    for (int q = 0; q < 100 && result == 0; q++) {
+      uint32_t target = rand() % (docid + 10);
+      uint32_t threshold = rand() % 2 ? rand() % 20 : rand() % 1000;
+      size_t expected = 0, found = 0;
+      for (uint32_t k = 0; k < length; k++)
+        expected += docids[k] >= target && values[k] > threshold;
+      for (size_t b = streamvbyte_blockmax_seek(blocks, nblocks, 0, target,
+                                                threshold);
+           b < nblocks;
+           b = streamvbyte_blockmax_seek(blocks, nblocks, b + 1, target,
+                                         threshold)) {
+        size_t count = streamvbyte_blockmax_decode_block(
+            compressed, blocks, b, length, blocksize, recovdocids, recovvalues);
+        for (size_t k = 0; k < count; k++)
+          found += recovdocids[k] >= target && recovvalues[k] > threshold;
+      }
+      if (found != expected) {
+        printf("[blockmaxtests] skipped too much blocksize = %d\n", blocksize);
+        result = -1;
+      }
+    }
+    free(blocks);
+    free(compressed);
+  }
+  free(docids);
+  free(values);
+  free(recovdocids);
+  free(recovvalues);
+  return result;
+}
+
+// return -1 in case of failure
+int postingstests() {
+  int N = 4096;
+  uint32_t *docids = malloc(N * sizeof(uint32_t));
+  uint32_t *freqs = malloc(N * sizeof(uint32_t));
+  uint32_t *recovdocids = malloc(N * sizeof(uint32_t));
+  uint32_t *recovfreqs = malloc(N * sizeof(uint32_t));
+  uint8_t *compressedbuffer =
+      malloc(streamvbyte_postings_max_compressedbytes(N));
+  int result = 0;
+  for (int length = 0; length <= N && result == 0;) {
+    uint32_t prev = (uint32_t)length;
+    uint32_t docid = prev;
+    for (int k = 0; k < length; ++k) {
+      docids[k] = docid += rand() >> (31 & rand()); // gaps of all sizes
+      freqs[k] = rand() % 8 ? (uint32_t)(1 + rand() % 4) : (uint32_t)rand();
+    }
+    size_t compsize = streamvbyte_postings_encode(docids, freqs, length,
+                                                  compressedbuffer, prev);
+    // decoded from a copy of the exact size, so that a sanitizer catches
+    // reads past the stream
+    uint8_t *exact = malloc(compsize > 0 ? compsize : 1);
+    memcpy(exact, compressedbuffer, compsize);
+    size_t usedbytes = streamvbyte_postings_decode(exact, recovdocids,
+                                                   recovfreqs, length, prev);
+    free(exact);
+    if (compsize != usedbytes ||
+        compsize > streamvbyte_postings_max_compressedbytes(length) ||
+        memcmp(docids, recovdocids, length * sizeof(uint32_t)) != 0 ||
+        memcmp(freqs, recovfreqs, length * sizeof(uint32_t)) != 0) {
+      printf("[postingstests] code is buggy length = %d\n", length);
+      result = -1;
+    }
+    if (length < 300)
+      ++length;
+    else
+      length *= 2;
+  }
+  free(docids);
+  free(freqs);
+  free(recovdocids);
+  free(recovfreqs);
+  free(compressedbuffer);
+  return result;
+}
+
+int updatabletests() {
+  int N = 4096;
+  uint32_t slack = 8;
+  uint32_t *datain = calloc(N, sizeof(uint32_t));
+  uint32_t *recovdata = malloc(N * sizeof(uint32_t));
+  streamvbyte_slot_t *slots =
+      malloc(streamvbyte_updatable_slots(N) * sizeof(streamvbyte_slot_t));
+  // room for every block to move once
+  size_t capacity = 2 * streamvbyte_updatable_max_compressedbytes(N, slack);
+  uint8_t *buffer = malloc(capacity);
+  uint8_t *compacted = malloc(capacity);
+  int result = 0;
+  for (int length = 0; length <= N && result == 0;) {
+    for (int k = 0; k < length; ++k)
+      datain[k] = (uint32_t)rand() % 200; // one byte each
+    size_t used = streamvbyte_updatable_encode(datain, length, slack, buffer,
+                                               slots);
+    // updates of all widths: some blocks overflow their slot and move, the
+    // buffer eventually fills up and is compacted
+    for (int u = 0; u < 4 * length && result == 0; ++u) {
+      uint32_t index = (uint32_t)rand() % (uint32_t)length;
+      uint32_t value = (uint32_t)rand() >> (31 & rand());
+      if (streamvbyte_updatable_set(buffer, &used, capacity, slots, length,
+                                    index, value) != 0) {
+        used = streamvbyte_updatable_compact(buffer, slots, length, slack,
+                                             compacted);
+        memcpy(buffer, compacted, used);
+        if (streamvbyte_updatable_set(buffer, &used, capacity, slots, length,
+                                      index, value) != 0) {
+          printf("[updatabletests] cannot update after compaction\n");
+          result = -1;
+        }
+      }
+      datain[index] = value;
+      if (streamvbyte_updatable_get(buffer, slots, length, index) != value) {
+        printf("[updatabletests] get is buggy length = %d\n", length);
+        result = -1;
+      }
+    }
+    streamvbyte_updatable_decode(buffer, slots, recovdata, length);
+    if (memcmp(datain, recovdata, length * sizeof(uint32_t)) != 0) {
+      printf("[updatabletests] code is buggy length = %d\n", length);
+      result = -1;
+    }
+    used = streamvbyte_updatable_compact(buffer, slots, length, slack,
+                                         compacted);
+    streamvbyte_updatable_decode(compacted, slots, recovdata, length);
+    if (used > streamvbyte_updatable_max_compressedbytes(length, slack) ||
+        memcmp(datain, recovdata, length * sizeof(uint32_t)) != 0) {
+      printf("[updatabletests] compaction is buggy length = %d\n", length);
+      result = -1;
+    }
+    if (length < 300)
+      ++length;
+    else
+      length *= 2;
+  }
+  free(datain);
+  free(recovdata);
+  free(slots);
+  free(buffer);
+  free(compacted);
+  return result;
+}
+
+int livetests() {
+  int N = 4096;
+  uint32_t *datain = malloc(N * sizeof(uint32_t));
+  uint32_t *expected = malloc(N * sizeof(uint32_t));
+  uint32_t *recovdata = malloc(N * sizeof(uint32_t));
+  uint8_t *compressedbuffer = malloc(streamvbyte_max_compressedbytes(N));
+  int result = 0;
+  for (int length = 0; length <= N && result == 0;) {
+    // every other gap is small so that the bitmap stays small
+    uint32_t prev = (uint32_t)length, docid = prev;
+    for (int k = 0; k < length; ++k)
+      datain[k] = docid += k % 2 ? (uint32_t)(rand() % 4) : (uint32_t)(rand() >> (31 & rand())) % 70000;
+    size_t words = (size_t)docid / 64 + 1;
+    uint64_t *live = malloc(words * sizeof(uint64_t));
+    size_t compsize = streamvbyte_delta_encode(datain, length, compressedbuffer, prev);
+    // none, some and all of the documents deleted
+    for (int deleted = 0; deleted <= 100 && result == 0; deleted += 25) {
+      for (size_t w = 0; w < words; ++w) {
+        live[w] = 0;
+        for (int b = 0; b < 64; ++b)
+          if (rand() % 100 >= deleted)
+            live[w] |= (uint64_t)1 << b;
+      }
+      size_t expectedcount = 0;
+      for (int k = 0; k < length; ++k)
+        if ((live[datain[k] / 64] >> (datain[k] % 64)) & 1)
+          expected[expectedcount++] = datain[k];
+      size_t count;
+      size_t usedbytes = streamvbyte_delta_decode_live(
+          compressedbuffer, recovdata, length, prev, live, &count);
+      if (usedbytes != compsize || count != expectedcount ||
+          memcmp(expected, recovdata, count * sizeof(uint32_t)) != 0) {
+        printf("[livetests] code is buggy length = %d deleted = %d%%\n",
+               length, deleted);
+        result = -1;
+      }
+    }
+    free(live);
+    if (length < 300)
+      ++length;
+    else
+      length *= 2;
+  }
+  free(datain);
+  free(expected);
+  free(recovdata);
+  free(compressedbuffer);
+  return result;
+}
+
+int cachetests() {
+  uint32_t N = 4096, blocksize = 128;
+  size_t nblocks = streamvbyte_blockmax_blocks(N, blocksize);
+  uint32_t *docids = malloc(N * sizeof(uint32_t));
+  uint32_t *values = malloc(N * sizeof(uint32_t));
+  uint32_t *scratch = malloc(2 * blocksize * sizeof(uint32_t));
+  uint32_t *expected = malloc(blocksize * sizeof(uint32_t));
+  streamvbyte_block_t *blocks = malloc(nblocks * sizeof(streamvbyte_block_t));
+  uint8_t *compressedbuffer =
+      malloc(streamvbyte_blockmax_max_compressedbytes(N, blocksize));
+  // room for about two sets of blocks, fewer than the stream has
+  size_t budget = 2 * STREAMVBYTE_CACHE_WAYS * (2 * blocksize + 8) * sizeof(uint32_t) + 1024;
+  void *mem = malloc(budget);
+  int result = 0;
+  uint32_t docid = 0;
+  for (uint32_t k = 0; k < N; ++k) {
+    docids[k] = docid += 1 + rand() % 100;
+    values[k] = (uint32_t)rand() % 1000;
+  }
+  streamvbyte_blockmax_encode(docids, values, N, blocksize, compressedbuffer,
+                              blocks);
+  streamvbyte_cache_t *cache = streamvbyte_cache_init(mem, budget, 2 * blocksize, 2);
+  if (streamvbyte_cache_init(mem, 256, 2 * blocksize, 2) != NULL || cache == NULL ||
+      streamvbyte_cache_capacity(cache) == 0 ||
+      streamvbyte_cache_capacity(cache) >= nblocks) {
+    printf("[cachetests] bad capacity\n");
+    result = -1;
+    goto done;
+  }
+  int reader = streamvbyte_cache_register(cache);
+  int writer = streamvbyte_cache_register(cache);
+  if (reader != 0 || writer != 1 || streamvbyte_cache_register(cache) != -1) {
+    printf("[cachetests] bad registration\n");
+    result = -1;
+    goto done;
+  }
+  // the reader holds block 0 while the writer goes through the stream many
+  // times: block 0 may be evicted but not overwritten
+  streamvbyte_cache_enter(cache, reader);
+  const uint32_t *held = streamvbyte_cache_blockmax(
+      cache, reader, 7, compressedbuffer, blocks, 0, N, blocksize, scratch);
+  uint32_t count;
+  if (held == scratch ||
+      streamvbyte_cache_lookup(cache, reader, 7, 0, &count) != held ||
+      count != 2 * blocksize) {
+    printf("[cachetests] block not cached\n");
+    result = -1;
+  }
+  if (streamvbyte_cache_insert(cache, reader, 7, 1, scratch,
+                               2 * blocksize + 1) != NULL) {
+    printf("[cachetests] block larger than a slot cached\n");
+    result = -1;
+  }
+  size_t hits = 0;
+  for (int pass = 0; pass < 4 * (int)nblocks && result == 0; ++pass) {
+    size_t b = (size_t)rand() % nblocks;
+    streamvbyte_cache_enter(cache, writer);
+    hits += streamvbyte_cache_lookup(cache, writer, 7, (uint32_t)b, &count) != NULL;
+    const uint32_t *got = streamvbyte_cache_blockmax(
+        cache, writer, 7, compressedbuffer, blocks, b, N, blocksize, scratch);
+    size_t n = streamvbyte_blockmax_decode_block(compressedbuffer, blocks, b, N,
+                                                 blocksize, expected, NULL);
+    if (memcmp(got, expected, n * sizeof(uint32_t)) != 0 ||
+        memcmp(got + n, values + b * blocksize, n * sizeof(uint32_t)) != 0 ||
+        memcmp(held, docids, blocksize * sizeof(uint32_t)) != 0 ||
+        memcmp(held + blocksize, values, blocksize * sizeof(uint32_t)) != 0) {
+      printf("[cachetests] code is buggy block = %zu\n", b);
+      result = -1;
+    }
+    streamvbyte_cache_leave(cache, writer);
+  }
+  streamvbyte_cache_leave(cache, reader);
+  if (result == 0 && hits == 0) {
+    printf("[cachetests] no hit\n");
+    result = -1;
+  }
+done:
+  free(docids);
+  free(values);
+  free(scratch);
+  free(expected);
+  free(blocks);
+  free(compressedbuffer);
+  free(mem);
+  return result;
+}
+
+int batchtests() {
+  size_t L = 100; // number of lists
+  uint32_t maxlength = 600;
+  streamvbyte_batch_t *lists = malloc(L * sizeof(streamvbyte_batch_t));
+  uint32_t *datain = malloc(maxlength * sizeof(uint32_t));
+  uint32_t *recovdata = malloc(L * maxlength * sizeof(uint32_t));
+  uint32_t *expected = malloc(L * maxlength * sizeof(uint32_t));
+  uint8_t *compressedbuffer =
+      malloc(L * streamvbyte_max_compressedbytes(maxlength));
+  int result = 0;
+  for (int delta = 0; delta <= 1 && result == 0; ++delta) {
+    uint8_t *p = compressedbuffer;
+    size_t compsize = 0;
+    for (size_t l = 0; l < L; ++l) {
+      // lengths of all sizes, some of them zero, some over several chunks
+      uint32_t length = (uint32_t)rand() % (l % 4 ? 40 : maxlength);
+      uint32_t prev = (uint32_t)rand() % 1000, docid = prev;
+      for (uint32_t k = 0; k < length; ++k)
+        datain[k] = delta ? (docid += (uint32_t)rand() >> (31 & rand()))
+                          : (uint32_t)rand() >> (31 & rand());
+      memcpy(expected + l * maxlength, datain, length * sizeof(uint32_t));
+      lists[l].in = p;
+      lists[l].out = recovdata + l * maxlength;
+      lists[l].length = length;
+      lists[l].prev = prev;
+      size_t size = delta ? streamvbyte_delta_encode(datain, length, p, prev)
+                          : streamvbyte_encode(datain, length, p);
+      p += size;
+      compsize += size;
+    }
+    size_t usedbytes = delta ? streamvbyte_delta_decode_batch(lists, L)
+                             : streamvbyte_decode_batch(lists, L);
+    if (usedbytes != compsize) {
+      printf("[batchtests] wrong size, delta = %d\n", delta);
+      result = -1;
+    }
+    for (size_t l = 0; l < L && result == 0; ++l) {
+      if (memcmp(expected + l * maxlength, lists[l].out,
+                 lists[l].length * sizeof(uint32_t)) != 0) {
+        printf("[batchtests] code is buggy list = %zu delta = %d\n", l, delta);
+        result = -1;
+      }
+    }
+  }
+  free(lists);
+  free(datain);
+  free(recovdata);
+  free(expected);
+  free(compressedbuffer);
+  return result;
+}
+
+// return -1 in case of failure
+int interleavedtests() {
+  int N = 4096;
+  uint32_t *datain = malloc(N * sizeof(uint32_t));
+  uint8_t *compressedbuffer =
+      malloc(streamvbyte_interleaved_max_compressedbytes(N));
+  uint32_t *recovdata = malloc(N * sizeof(uint32_t));
+  int result = 0;
+  for (int length = 0; length <= N && result == 0;) {
+    for (int streams = 1; streams <= STREAMVBYTE_INTERLEAVED_MAX_STREAMS;
+         ++streams) {
+      for (int k = 0; k < length; ++k)
+        datain[k] = (k / 64) % 2 ? (uint32_t)rand() % 200
+                                 : (uint32_t)rand() >> (31 & rand());
+      // the encoder must not write past the bytes it reports
+      memset(compressedbuffer, 0xA5,
+             streamvbyte_interleaved_max_compressedbytes(N));
+      size_t compsize = streamvbyte_interleaved_encode(
+          datain, length, compressedbuffer, streams);
+      size_t usedbytes =
+          streamvbyte_interleaved_decode(compressedbuffer, recovdata, length);
+      if (compsize != usedbytes ||
+          memcmp(datain, recovdata, length * sizeof(uint32_t)) != 0) {
+        printf("[interleavedtests] code is buggy length = %d streams = %d\n",
+               length, streams);
+        result = -1;
+        break;
+      }
+      for (size_t b = compsize;
+           b < streamvbyte_interleaved_max_compressedbytes(N); ++b) {
+        if (compressedbuffer[b] != 0xA5) {
+          printf("[interleavedtests] wrote past the end length = %d\n",
+                 length);
+          result = -1;
+          break;
+        }
+      }
+      if (result == -1)
+        break;
+    }
+    if (length < 300)
+      ++length;
+    else
+      length *= 2;
+  }
+  if (result == 0 &&
+      streamvbyte_interleaved_encode(datain, 16, compressedbuffer,
+                                     STREAMVBYTE_INTERLEAVED_MAX_STREAMS + 1) != 0) {
+    printf("[interleavedtests] accepted too many sub-streams\n");
+    result = -1;
+  }
+  free(datain);
+  free(compressedbuffer);
+  free(recovdata);
+  return result;
+}
+
+// fills values with a sorted set mixing dense, sparse and empty chunks,
+// returns its cardinality
+static uint32_t random_set(uint32_t *values, uint32_t chunks) {
+  uint32_t n = 0;
+  for (uint32_t chunk = 0; chunk < chunks; chunk++) {
+    int kind = rand() % 4; // empty, sparse, medium, dense
+    uint32_t gap = kind == 1 ? 2000 : kind == 2 ? 40 : 3;
+    for (uint32_t v = rand() % gap; kind > 0 && v < 65536; v += 1 + rand() % gap)
+      values[n++] = (chunk << 16) | v;
+  }
+  return n;
+}
+
+// return -1 in case of failure
+int settests() {
+  uint32_t chunks = 12, maxlength = chunks * 65536;
+  uint32_t *a = malloc(maxlength * sizeof(uint32_t));
+  uint32_t *b = malloc(maxlength * sizeof(uint32_t));
+  uint32_t *expected = malloc(2 * maxlength * sizeof(uint32_t));
+  uint32_t *recovdata = malloc(2 * maxlength * sizeof(uint32_t));
+  uint8_t *ca = malloc(streamvbyte_set_max_compressedbytes(maxlength));
+  uint8_t *cb = malloc(streamvbyte_set_max_compressedbytes(maxlength));
+  int result = 0;
+  for (int trial = 0; trial < 20 && result == 0; trial++) {
+    uint32_t na = trial == 0 ? 0 : random_set(a, chunks);
+    uint32_t nb = random_set(b, chunks);
+    size_t sizea = streamvbyte_set_encode(a, na, ca);
+    streamvbyte_set_encode(b, nb, cb);
+    if (sizea > streamvbyte_set_max_compressedbytes(na) ||
+        streamvbyte_set_cardinality(ca) != na ||
+        streamvbyte_set_decode(ca, recovdata) != na ||
+        memcmp(a, recovdata, na * sizeof(uint32_t)) != 0) {
+      printf("[settests] code is buggy trial = %d\n", trial);
+      result = -1;
+      break;
+    }
+    for (uint32_t k = 0; k < 1000; k++) {
+      uint32_t value =
+          na > 0 && k % 2 ? a[rand() % na] : (uint32_t)rand() % maxlength;
+      int found = 0;
+      for (uint32_t lo = 0, hi = na; lo < hi;) { // binary search
+        uint32_t mid = lo + (hi - lo) / 2;
+        if (a[mid] == value) {
+          found = 1;
+          break;
+        }
+        if (a[mid] < value)
+          lo = mid + 1;
+        else
+          hi = mid;
+      }
+      if (streamvbyte_set_contains(ca, value) != found) {
+        printf("[settests] contains is buggy trial = %d value = %u\n", trial,
+               value);
+        result = -1;
+        break;
+      }
+    }
+    for (int op = 0; op < 2 && result == 0; op++) {
+      size_t n = 0, i = 0, j = 0;
+      while (i < na || j < nb) { // merge
+        if (j == nb || (i < na && a[i] < b[j])) {
+          if (op == 1)
+            expected[n++] = a[i];
+          i++;
+        } else if (i == na || b[j] < a[i]) {
+          if (op == 1)
+            expected[n++] = b[j];
+          j++;
+        } else {
+          expected[n++] = a[i];
+          i++;
+          j++;
+        }
+      }
+      size_t got = op == 0 ? streamvbyte_set_intersect(ca, cb, recovdata)
+                           : streamvbyte_set_union(ca, cb, recovdata);
+      if (got != n || memcmp(expected, recovdata, n * sizeof(uint32_t)) != 0) {
+        printf("[settests] %s is buggy trial = %d\n",
+               op == 0 ? "intersection" : "union", trial);
+        result = -1;
+      }
+    }
+  }
+  free(a);
+  free(b);
+  free(expected);
+  free(recovdata);
+  free(ca);
+  free(cb);
+  return result;
+}
+
+int seriestests() {
+  uint32_t N = 20000, duration = 60000, maxsamples = 120, maxchunks = 64;
+  uint64_t *timestamps = malloc(N * sizeof(uint64_t));
+  uint32_t *values = malloc(N * sizeof(uint32_t));
+  uint64_t *recovtimestamps = malloc(N * sizeof(uint64_t));
+  uint32_t *recovdata = malloc(N * sizeof(uint32_t));
+  // room for fewer chunks than the samples take: old ones must be dropped
+  size_t budget = 16384;
+  void *mem = malloc(budget);
+  int result = 0;
+  // samples every second or so, from a random walk
+  uint64_t t = (uint64_t)1 << 40;
+  uint32_t v = 1000;
+  for (uint32_t k = 0; k < N; ++k) {
+    timestamps[k] = t += k % 1000 == 0 ? 100000 : 990 + rand() % 20;
+    values[k] = v += (uint32_t)(rand() % 21) - 10;
+  }
+  streamvbyte_series_t *series =
+      streamvbyte_series_init(mem, budget, duration, maxsamples, maxchunks);
+  if (series == NULL || streamvbyte_series_init(mem, 1024, duration, maxsamples,
+                                                maxchunks) != NULL ||
+      streamvbyte_series_init(mem, budget, 0, maxsamples, maxchunks) != NULL) {
+    printf("[seriestests] bad init\n");
+    result = -1;
+    goto done;
+  }
+  uint32_t oldest = 0; // first sample still stored
+  for (uint32_t k = 0; k < N && result == 0; ++k) {
+    while (streamvbyte_series_append(series, timestamps[k], values[k]) != 0) {
+      // full: drop the oldest window (its chunks end before the next one)
+      size_t dropped = streamvbyte_series_drop_before(
+          series, timestamps[oldest] + duration);
+      if (dropped == 0) {
+        printf("[seriestests] cannot append k = %u\n", k);
+        result = -1;
+        break;
+      }
+      oldest += dropped;
+    }
+    if (result != 0)
+      break;
+    if (streamvbyte_series_append(series, timestamps[k] - 1, 0) != -1 ||
+        streamvbyte_series_count(series) != k + 1 - oldest) {
+      printf("[seriestests] bad append k = %u\n", k);
+      result = -1;
+      break;
+    }
+    if (k % 97 != 0)
+      continue;
+    // a random range (possibly ending after the last sample), and one
+    // starting at a sample
+    for (int r = 0; r < 2; r++) {
+      uint32_t first = oldest + (uint32_t)rand() % (k + 1 - oldest);
+      uint64_t from = r == 0 ? timestamps[first] - rand() % 2000 : timestamps[first];
+      uint64_t to = from + (uint64_t)(rand() % 300000) + 1;
+      size_t n = 0;
+      while (first > oldest && timestamps[first - 1] >= from)
+        first--;
+      while (first + n <= k && timestamps[first + n] < to)
+        n++;
+      if (timestamps[first] < from) { // from is past every sample
+        first++;
+        n = 0;
+      }
+      size_t bound = streamvbyte_series_query_bound(series, from, to);
+      size_t got = bound > N ? 0 : streamvbyte_series_query(
+                                       series, from, to, recovtimestamps,
+                                       recovdata);
+      if (bound > N || bound < n || got != n ||
+          memcmp(recovtimestamps, timestamps + first, n * sizeof(uint64_t)) != 0 ||
+          memcmp(recovdata, values + first, n * sizeof(uint32_t)) != 0) {
+        printf("[seriestests] query is buggy k = %u\n", k);
+        result = -1;
+        break;
+      }
+    }
+  }
+  while (result == 0 && streamvbyte_series_flush(series) != 0)
+    oldest += streamvbyte_series_drop_before(series, timestamps[oldest] + duration);
+  // about 1 byte per timestamp and per value, and the control bytes
+  if (result == 0 && (oldest == 0 || streamvbyte_series_compressedbytes(series) >
+                                         3 * streamvbyte_series_count(series))) {
+    printf("[seriestests] bad retention or compression\n");
+    result = -1;
+  }
+  if (result == 0 &&
+      (streamvbyte_series_drop_before(series, timestamps[N - 1] + 1) !=
+           N - oldest ||
+       streamvbyte_series_count(series) != 0 ||
+       streamvbyte_series_compressedbytes(series) != 0 ||
+       streamvbyte_series_append(series, 0, 0) != 0)) {
+    printf("[seriestests] cannot drop everything\n");
+    result = -1;
+  }
+done:
+  free(timestamps);
+  free(values);
+  free(recovtimestamps);
+  free(recovdata);
+  free(mem);
+  return result;
+}
+
 int main() {
   if (basictests() == -1)
     return -1;
   if (aqrittests() == -1)
     return -1;
+  if (uniformtests() == -1)
+    return -1;
+  if (columnstests() == -1)
+    return -1;
+  if (exactboundtests() == -1)
+    return -1;
+  if (largecounttests() == -1)
+    return -1;
+  if (rletests() == -1)
+    return -1;
+  if (archivetests() == -1)
+    return -1;
+  if (transformtests() == -1)
+    return -1;
+  if (blockmaxtests() == -1)
+    return -1;
+  if (postingstests() == -1)
+    return -1;
+  if (updatabletests() == -1)
+    return -1;
+  if (livetests() == -1)
+    return -1;
+  if (cachetests() == -1)
+    return -1;
+  if (batchtests() == -1)
+    return -1;
+  if (interleavedtests() == -1)
+    return -1;
+  if (settests() == -1)
+    return -1;
+  if (seriestests() == -1)
+    return -1;
   printf("Code looks good.\n");
   if (isLittleEndian()) {
     printf("And you have a little endian architecture.\n");
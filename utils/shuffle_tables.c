@@ -49,13 +49,19 @@ static void encoder_permutation(uint8_t *table, uint8_t *lengths ) {
 
 // to be used after calling either  decoder_permutation or encoder_permutation
 // table should point at 256*16 bytes
+// the bytes zeroed by the shuffle are printed as 0xFF rather than -1: the
+// tables are uint8_t, and C++ rejects narrowing -1 in an initializer
 static void print_permutation(uint8_t *table) {
   for(int code = 0; code < 256; code++) {
-    int x;
     printf(" {");
-    for(int i = 0; i < 15; i++)
-      printf(" %2d,", x = (int8_t) table[code*16 + i]);
-    printf( " %2d", x = (int8_t) table[code*16 + 15]);
+    for(int i = 0; i < 16; i++) {
+      uint8_t x = table[code*16 + i];
+      if (x == 0xFF)
+        printf(" 0xFF");
+      else
+        printf(" %4d", x);
+      printf(i < 15 ? "," : "");
+    }
     printf(" },    // %d%d%d%d\n",
            extract(code,0)+1,
            extract(code,1)+1,
@@ -86,6 +92,8 @@ int main() {
   encoder_permutation(encoder_table, lengths);
   decoder_permutation(decoder_table, lengths);
 
+  printf("#ifndef STREAMVBYTE_SHUFFLE_TABLES_H_\n");
+  printf("#define STREAMVBYTE_SHUFFLE_TABLES_H_\n\n");
   printf("static uint8_t lengthTable[256] =");
   print_lengths(lengths);
   printf(";\n\n");
@@ -95,10 +103,15 @@ int main() {
   print_permutation(decoder_table);
   printf("};\n\n");
 
-  printf("// encoding:\n");
+  // only the translation units encoding with it define the encoding table:
+  // the others would warn about an unused variable
+  printf("// encoding (define SVB_ENCODING_SHUFFLE_TABLE to use it):\n");
+  printf("#ifdef SVB_ENCODING_SHUFFLE_TABLE\n");
   printf("static uint8_t encodingShuffleTable[256][16] = {\n");
   print_permutation(encoder_table);
   printf("};\n");
+  printf("#endif\n\n");
+  printf("#endif /* STREAMVBYTE_SHUFFLE_TABLES_H_ */\n");
   return 0;
 
 }